@@ -495,6 +495,19 @@ AC_DEFUN([AC_GECODE_AUDIT],
      fi])
 
 
+AC_DEFUN([AC_GECODE_ACTIVITY],
+    [AC_ARG_ENABLE([activity],
+       AC_HELP_STRING([--enable-activity],
+         [record variable activity for branching @<:@default=no@:>@]))
+     AC_MSG_CHECKING(whether to record variable activity)
+     if test "${enable_activity:-no}" = "yes"; then
+        AC_DEFINE([GECODE_HAS_ACTIVITY],[],
+                  [Whether variables record their activity])
+        AC_MSG_RESULT(yes)
+     else
+        AC_MSG_RESULT(no)
+     fi])
+
 AC_DEFUN([AC_GECODE_PROFILE],
      [AC_ARG_ENABLE([profile],
        AC_HELP_STRING([--enable-profile],
@@ -1177,6 +1190,14 @@ AC_DEFUN([AC_GECODE_THREADS],[
   [AC_DEFINE(GECODE_THREADS_PTHREADS,1,[Whether we have posix threads])
    AC_GECODE_ADD_TO_COMPILERFLAGS([-pthread])
    AC_GECODE_ADD_TO_DLLFLAGS([-pthread])
+   AC_CHECK_DECL(pthread_setaffinity_np,
+     [AC_DEFINE(GECODE_HAS_THREAD_AFFINITY,1,
+        [Whether threads can be bound to processing units])],
+     [],
+     [[#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>]])
   ],
   [AC_CHECK_HEADER(windows.h,
     [AC_DEFINE(GECODE_THREADS_WINDOWS,1,[Whether we have windows threads])])]
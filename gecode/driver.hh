@@ -99,9 +99,21 @@ namespace Gecode {
     SM_SOLUTION, ///< Print solution and some statistics
     SM_TIME,     ///< Measure average runtime
     SM_STAT,     ///< Print statistics for script
+    SM_BENCH,    ///< Print machine-readable statistics for each sample
     SM_GIST      ///< Run script in Gist
   };
 
+  /**
+   * \brief Different modes for restart-based search
+   * \ingroup TaskDriverCmd
+   */
+  enum RestartMode {
+    RM_NONE,     ///< No restarts
+    RM_CONSTANT, ///< Restart with constant sequence
+    RM_LUBY,     ///< Restart with Luby sequence
+    RM_GEOMETRIC ///< Restart with geometric sequence
+  };
+
   class BaseOptions;
 
   namespace Driver {
@@ -237,7 +249,7 @@ namespace Gecode {
       double cur; ///< Current value
     public:
       /// Initialize for option \a o and explanation \a e and default value \a v
-      DoubleOption(const char* o, const char* e, unsigned int v=0);
+      DoubleOption(const char* o, const char* e, double v=0);
       /// Set default value to \a v
       void value(double v);
       /// Return current option value
@@ -312,6 +324,8 @@ namespace Gecode {
     Driver::StringOption _propagation; ///< Propagation options
     Driver::StringOption _icl;         ///< Integer consistency level
     Driver::StringOption _branching;   ///< Branching options
+    Driver::DoubleOption _decay;       ///< Decay option
+    Driver::UnsignedIntOption _idle;   ///< Idle limit option
     //@}
     
     /// \name Search options
@@ -321,10 +335,16 @@ namespace Gecode {
     Driver::DoubleOption      _threads;   ///< How many threads to use
     Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+    Driver::UnsignedIntOption _d_l;       ///< Discrepancy limit for LDS
     Driver::UnsignedIntOption _node;      ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;      ///< Cutoff for number of failures
     Driver::UnsignedIntOption _time;      ///< Cutoff for time
     Driver::StringOption      _interrupt; ///< Whether to catch SIGINT
+    Driver::StringOption      _restart;   ///< Restart mode
+    Driver::UnsignedIntOption _r_scale;   ///< Scale factor for restart cutoff
+    Driver::DoubleOption      _r_base;    ///< Base for geometric restart cutoff
+    Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for no-goods
+    Driver::UnsignedIntOption _memory_limit;  ///< Memory limit for search
     //@}
     
     /// \name Execution options
@@ -332,6 +352,7 @@ namespace Gecode {
     Driver::StringOption      _mode;       ///< Script mode to run
     Driver::UnsignedIntOption _samples;    ///< How many samples
     Driver::UnsignedIntOption _iterations; ///< How many iterations per sample
+    Driver::StringOption      _profile;    ///< Whether to profile propagators
     //@}
 
   public:
@@ -372,6 +393,16 @@ namespace Gecode {
     void branching(int v, const char* o, const char* h = NULL);
     /// Return branching value
     int branching(void) const;
+
+    /// Set default decay factor
+    void decay(double d);
+    /// Return decay factor
+    double decay(void) const;
+
+    /// Set default limit for deferring idle propagators
+    void idle(unsigned int n);
+    /// Return limit for deferring idle propagators
+    unsigned int idle(void) const;
     //@}
     
     /// \name Search options
@@ -403,6 +434,11 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
     
+    /// Set default discrepancy limit for LDS
+    void d_l(unsigned int d);
+    /// Return discrepancy limit for LDS
+    unsigned int d_l(void) const;
+    
     /// Set default node cutoff
     void node(unsigned int n);
     /// Return node cutoff
@@ -422,6 +458,31 @@ namespace Gecode {
     void interrupt(bool b);
     /// Return interrupt behavior
     bool interrupt(void) const;
+
+    /// Set default restart mode
+    void restart(RestartMode r);
+    /// Return restart mode
+    RestartMode restart(void) const;
+
+    /// Set default scale factor for restart cutoff
+    void restart_scale(unsigned int s);
+    /// Return scale factor for restart cutoff
+    unsigned int restart_scale(void) const;
+
+    /// Set default base for geometric restart cutoff
+    void restart_base(double b);
+    /// Return base for geometric restart cutoff
+    double restart_base(void) const;
+
+    /// Set default depth limit for no-goods recorded on restart
+    void nogoods_limit(unsigned int l);
+    /// Return depth limit for no-goods recorded on restart
+    unsigned int nogoods_limit(void) const;
+
+    /// Set default memory limit (in KB) for adapting the commit distance
+    void memory_limit(unsigned int l);
+    /// Return memory limit (in KB) for adapting the commit distance
+    unsigned int memory_limit(void) const;
     //@}
 
     /// \name Execution options
@@ -440,6 +501,11 @@ namespace Gecode {
     void samples(unsigned int s);
     /// Return number of samples
     unsigned int samples(void) const;
+
+    /// Set default propagator profiling behavior
+    void profile(bool b);
+    /// Return propagator profiling behavior
+    bool profile(void) const;
     //@}
 
 #ifdef GECODE_HAS_GIST
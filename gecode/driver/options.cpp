@@ -346,6 +346,8 @@ namespace Gecode {
       _propagation("-propagation","propagation variants"),
       _icl("-icl","integer consistency level",ICL_DEF),
       _branching("-branching","branching variants"),
+      _decay("-decay","decay factor for AFC",1.0),
+      _idle("-idle","defer expensive propagators idle for this many executions (0 = never)",0),
       
       _search("-search","search engine variants"),
       _solutions("-solutions","number of solutions (0 = all)",1),
@@ -353,14 +355,21 @@ namespace Gecode {
                Search::Config::threads),
       _c_d("-c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("-a-d","recomputation adaptation distance",Search::Config::a_d),
+      _d_l("-d-l","discrepancy limit for LDS",Search::Config::d_l),
       _node("-node","node cutoff (0 = none, solution mode)"),
       _fail("-fail","failure cutoff (0 = none, solution mode)"),
       _time("-time","time (in ms) cutoff (0 = none, solution mode)"),
       _interrupt("-interrupt","whether to catch Ctrl-C (true) or not (false)", true),
+      _restart("-restart","restart mode (restart-based search only)",RM_NONE),
+      _r_scale("-restart-scale","scale factor for restart cutoff",100),
+      _r_base("-restart-base","base for geometric restart cutoff",1.5),
+      _nogoods_limit("-nogoods-limit","depth limit for no-goods recorded on restart (0 = none)",0),
+      _memory_limit("-memory-limit","memory limit in KB for adapting the commit distance (0 = none)",0),
       
       _mode("-mode","how to execute script",SM_SOLUTION),
-      _samples("-samples","how many samples (time mode)",1),
-      _iterations("-iterations","iterations per sample (time mode)",1)
+      _samples("-samples","how many samples (time and bench mode)",1),
+      _iterations("-iterations","iterations per sample (time mode)",1),
+      _profile("-profile","whether to profile propagators (solution and stat mode)",false)
   {
     
     _icl.add(ICL_DEF, "def"); _icl.add(ICL_VAL, "val");
@@ -369,16 +378,28 @@ namespace Gecode {
     _mode.add(SM_SOLUTION, "solution");
     _mode.add(SM_TIME, "time");
     _mode.add(SM_STAT, "stat");
+    _mode.add(SM_BENCH, "bench");
     _mode.add(SM_GIST, "gist");
     
     _interrupt.add(false, "false");
     _interrupt.add(true, "true");
+
+    _profile.add(false, "false");
+    _profile.add(true, "true");
+
+    _restart.add(RM_NONE, "none");
+    _restart.add(RM_CONSTANT, "constant");
+    _restart.add(RM_LUBY, "luby");
+    _restart.add(RM_GEOMETRIC, "geometric");
     
     add(_model); add(_symmetry); add(_propagation); add(_icl); 
-    add(_branching);
+    add(_branching); add(_decay); add(_idle);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
-    add(_mode); add(_iterations); add(_samples);
+    add(_restart); add(_r_scale); add(_r_base);
+    add(_nogoods_limit); add(_memory_limit);
+    add(_mode); add(_iterations); add(_samples); add(_profile);
   }
 
   
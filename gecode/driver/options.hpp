@@ -114,7 +114,7 @@ namespace Gecode {
      */
     inline
     DoubleOption::DoubleOption(const char* o, const char* e,
-                               unsigned int v)
+                               double v)
       : BaseOption(o,e), cur(v) {}
     inline void
     DoubleOption::value(double v) {
@@ -229,6 +229,24 @@ namespace Gecode {
   Options::branching(void) const {
     return _branching.value();
   }
+
+  inline void
+  Options::decay(double d) {
+    _decay.value(d);
+  }
+  inline double
+  Options::decay(void) const {
+    return _decay.value();
+  }
+
+  inline void
+  Options::idle(unsigned int n) {
+    _idle.value(n);
+  }
+  inline unsigned int
+  Options::idle(void) const {
+    return _idle.value();
+  }
   
   /*
    * Search options
@@ -283,6 +301,15 @@ namespace Gecode {
     return _a_d.value();
   }
   
+  inline void
+  Options::d_l(unsigned int d) {
+    _d_l.value(d);
+  }
+  inline unsigned int
+  Options::d_l(void) const {
+    return _d_l.value();
+  }
+  
   inline void
   Options::node(unsigned int n) {
     _node.value(n);
@@ -318,6 +345,51 @@ namespace Gecode {
   Options::interrupt(void) const {
     return static_cast<bool>(_interrupt.value());
   }
+
+  inline void
+  Options::restart(RestartMode r) {
+    _restart.value(r);
+  }
+  inline RestartMode
+  Options::restart(void) const {
+    return static_cast<RestartMode>(_restart.value());
+  }
+
+  inline void
+  Options::restart_scale(unsigned int s) {
+    _r_scale.value(s);
+  }
+  inline unsigned int
+  Options::restart_scale(void) const {
+    return _r_scale.value();
+  }
+
+  inline void
+  Options::restart_base(double b) {
+    _r_base.value(b);
+  }
+  inline double
+  Options::restart_base(void) const {
+    return _r_base.value();
+  }
+
+  inline void
+  Options::nogoods_limit(unsigned int l) {
+    _nogoods_limit.value(l);
+  }
+  inline unsigned int
+  Options::nogoods_limit(void) const {
+    return _nogoods_limit.value();
+  }
+
+  inline void
+  Options::memory_limit(unsigned int l) {
+    _memory_limit.value(l);
+  }
+  inline unsigned int
+  Options::memory_limit(void) const {
+    return _memory_limit.value();
+  }
   
   
   /*
@@ -351,6 +423,15 @@ namespace Gecode {
     return _samples.value();
   }
 
+  inline void
+  Options::profile(bool b) {
+    _profile.value(b);
+  }
+  inline bool
+  Options::profile(void) const {
+    return static_cast<bool>(_profile.value());
+  }
+
 #ifdef GECODE_HAS_GIST
   forceinline
   Options::_I::_I(void) : _click(heap,1), n_click(0),
@@ -130,6 +130,24 @@ namespace Gecode { namespace Driver {
     }
   };
 
+  /// Create cutoff sequence for restart-based search from options \a o
+  inline Search::Cutoff*
+  createCutoff(const Gecode::Options& o) {
+    switch (o.restart()) {
+    case RM_NONE:
+      return NULL;
+    case RM_CONSTANT:
+      return new Search::CutoffConstant(o.restart_scale());
+    case RM_LUBY:
+      return new Search::CutoffLuby(o.restart_scale());
+    case RM_GEOMETRIC:
+      return new Search::CutoffGeometric(o.restart_scale(),o.restart_base());
+    default:
+      GECODE_NEVER;
+    }
+    return NULL;
+  }
+
   /**
    * \brief Get time since start of timer and print user friendly time
    * information.
@@ -167,6 +185,15 @@ namespace Gecode { namespace Driver {
     }
   };
   
+  /// Specialization for LDS
+  template<typename S>
+  class GistEngine<LDS<S> > {
+  public:
+    static void explore(S* root, const Gist::Options& opt) {
+      (void) Gist::dfs(root, opt);
+    }
+  };
+  
   /// Specialization for BAB
   template<typename S>
   class GistEngine<BAB<S> > {
@@ -184,6 +211,15 @@ namespace Gecode { namespace Driver {
       (void) Gist::bab(root, opt);
     }
   };
+
+  /// Specialization for RBS
+  template<typename S>
+  class GistEngine<RBS<S> > {
+  public:
+    static void explore(S* root, const Gist::Options& opt) {
+      (void) Gist::bab(root, opt);
+    }
+  };
   
 #endif
 
@@ -214,6 +250,8 @@ namespace Gecode { namespace Driver {
           for (int i=0; o.inspect.compare(i) != NULL; i++)
             opt.inspect.compare(o.inspect.compare(i));
           Script* s = new Script(o);
+          s->afc_decay(o.decay());
+          s->idle_limit(o.idle());
           (void) GistEngine<Engine<Script> >::explore(s, opt);
         }
         break;
@@ -226,30 +264,43 @@ namespace Gecode { namespace Driver {
           int i = o.solutions();
           t.start();
           Script* s = new Script(o);
+          s->afc_decay(o.decay());
+          s->idle_limit(o.idle());
           unsigned int n_p = s->propagators();
           unsigned int n_b = s->branchers();
           Search::Options so;
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.d_l     = o.d_l();
           so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), 
                                       o.interrupt());
+          so.cutoff  = createCutoff(o);
+          so.nogoods_limit = o.nogoods_limit();
+          so.memory_limit = static_cast<size_t>(o.memory_limit()) * 1024;
           so.clone   = false;
+          so.profile = o.profile() ? new PropagatorProfile : NULL;
           if (o.interrupt())
             Cutoff::installCtrlHandler(true);
-          Engine<Script> e(s,so);
-          do {
-            Script* ex = e.next();
-            if (ex == NULL)
-              break;
-            ex->print(std::cout);
-            delete ex;
-          } while (--i != 0);
+          Search::Statistics stat;
+          bool stopped;
+          {
+            Engine<Script> e(s,so);
+            do {
+              Script* ex = e.next();
+              if (ex == NULL)
+                break;
+              ex->print(std::cout);
+              delete ex;
+            } while (--i != 0);
+            stat = e.statistics();
+            stopped = e.stopped();
+          }
+          delete so.cutoff;
           if (o.interrupt())
             Cutoff::installCtrlHandler(false);
-          Search::Statistics stat = e.statistics();
           cout << endl;
-          if (e.stopped()) {
+          if (stopped) {
             cout << "Search engine stopped..." << endl
                  << "\treason: ";
             int r = static_cast<Cutoff*>(so.stop)->reason(stat,so);
@@ -282,6 +333,11 @@ namespace Gecode { namespace Driver {
                << "\tpeak memory:  "
                << static_cast<int>((stat.memory+1023) / 1024) << " KB"
                << endl;
+          if (so.profile != NULL) {
+            cout << endl << "Propagator profile" << endl;
+            so.profile->print(cout);
+            delete so.profile;
+          }
         }
         break;
       case SM_STAT:
@@ -291,6 +347,8 @@ namespace Gecode { namespace Driver {
           int i = o.solutions();
           t.start();
           Script* s = new Script(o);
+          s->afc_decay(o.decay());
+          s->idle_limit(o.idle());
           unsigned int n_p = s->propagators();
           unsigned int n_b = s->branchers();
           Search::Options so;
@@ -298,20 +356,29 @@ namespace Gecode { namespace Driver {
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.d_l     = o.d_l();
           so.stop    = Cutoff::create(o.node(),o.fail(), o.time(),
                                       o.interrupt());
+          so.cutoff  = createCutoff(o);
+          so.nogoods_limit = o.nogoods_limit();
+          so.memory_limit = static_cast<size_t>(o.memory_limit()) * 1024;
+          so.profile = o.profile() ? new PropagatorProfile : NULL;
           if (o.interrupt())
             Cutoff::installCtrlHandler(true);
-          Engine<Script> e(s,so);
-          do {
-            Script* ex = e.next();
-            if (ex == NULL)
-              break;
-            delete ex;
-          } while (--i != 0);
+          Search::Statistics stat;
+          {
+            Engine<Script> e(s,so);
+            do {
+              Script* ex = e.next();
+              if (ex == NULL)
+                break;
+              delete ex;
+            } while (--i != 0);
+            stat = e.statistics();
+          }
+          delete so.cutoff;
           if (o.interrupt())
             Cutoff::installCtrlHandler(false);
-          Search::Statistics stat = e.statistics();
           cout << endl
                << "\tpropagators:  " << n_p << endl
                << "\tbranchers:    " << n_b << endl
@@ -327,6 +394,11 @@ namespace Gecode { namespace Driver {
                << "\tpeak memory:  "
                << static_cast<int>((stat.memory+1023) / 1024) << " KB"
                << endl;
+          if (so.profile != NULL) {
+            cout << endl << "Propagator profile" << endl;
+            so.profile->print(cout);
+            delete so.profile;
+          }
         }
         break;
       case SM_TIME:
@@ -340,21 +412,30 @@ namespace Gecode { namespace Driver {
             for (unsigned int k = o.iterations(); !stopped && k--; ) {
               unsigned int i = o.solutions();
               Script* s = new Script(o);
+              s->afc_decay(o.decay());
+              s->idle_limit(o.idle());
               Search::Options so;
               so.clone   = false;
               so.threads = o.threads();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
+              so.d_l     = o.d_l();
               so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), false);
-              Engine<Script> e(s,so);
-              do {
-                Script* ex = e.next();
-                if (ex == NULL)
-                  break;
-                delete ex;
-              } while (--i != 0);
-              if (e.stopped())
-                stopped = true;
+              so.cutoff  = createCutoff(o);
+              so.nogoods_limit = o.nogoods_limit();
+              so.memory_limit = static_cast<size_t>(o.memory_limit()) * 1024;
+              {
+                Engine<Script> e(s,so);
+                do {
+                  Script* ex = e.next();
+                  if (ex == NULL)
+                    break;
+                  delete ex;
+                } while (--i != 0);
+                if (e.stopped())
+                  stopped = true;
+              }
+              delete so.cutoff;
             }
             ts[s] = t.stop() / o.iterations();
           }
@@ -373,6 +454,53 @@ namespace Gecode { namespace Driver {
           delete [] ts;
         }
         break;
+      case SM_BENCH:
+        {
+          cout << "script,sample,runtime,solutions,propagations,nodes,"
+               << "failures,depth,memory,clones,stopped" << endl;
+          Support::Timer t;
+          for (unsigned int k = 0; k < o.samples(); k++) {
+            int i = o.solutions();
+            t.start();
+            Script* s = new Script(o);
+            s->afc_decay(o.decay());
+            s->idle_limit(o.idle());
+            Search::Options so;
+            so.clone   = false;
+            so.threads = o.threads();
+            so.c_d     = o.c_d();
+            so.a_d     = o.a_d();
+            so.d_l     = o.d_l();
+            so.stop    = Cutoff::create(o.node(),o.fail(), o.time(), false);
+            so.cutoff  = createCutoff(o);
+            so.nogoods_limit = o.nogoods_limit();
+            so.memory_limit = static_cast<size_t>(o.memory_limit()) * 1024;
+            {
+              Engine<Script> e(s,so);
+              do {
+                Script* ex = e.next();
+                if (ex == NULL)
+                  break;
+                delete ex;
+              } while (--i != 0);
+              double r = t.stop();
+              Search::Statistics stat = e.statistics();
+              cout << o.name() << "," << k << ","
+                   << fixed << setprecision(3) << r << ","
+                   << ::abs(static_cast<int>(o.solutions()) - i) << ","
+                   << stat.propagate << ","
+                   << stat.node << ","
+                   << stat.fail << ","
+                   << stat.depth << ","
+                   << stat.memory << ","
+                   << stat.clone << ","
+                   << (e.stopped() ? 1 : 0) << endl;
+            }
+            delete so.stop;
+            delete so.cutoff;
+          }
+        }
+        break;
       }
     } catch (Exception e) {
       cerr << "Exception: " << e.what() << "." << endl
@@ -174,6 +174,7 @@ namespace Gecode { namespace FlatZinc {
       //@{
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::StringOption      _print;      ///< Print all solutions
+      Gecode::Driver::BoolOption        _profile;    ///< Profile propagators
       //@}
   public:
     enum SearchOptions {
@@ -197,7 +198,8 @@ namespace Gecode { namespace FlatZinc {
       _fail("-fail","failure cutoff (0 = none, solution mode)"),
       _time("-time","time (in ms) cutoff (0 = none, solution mode)"),
       _mode("-mode","how to execute script",Gecode::SM_SOLUTION),
-      _print("-print","which solutions to print",0) {
+      _print("-print","which solutions to print",0),
+      _profile("-profile","print propagator profile (stat mode)") {
 
       _search.add(FZ_SEARCH_BAB, "bab");
       _search.add(FZ_SEARCH_RESTART, "restart");
@@ -214,6 +216,7 @@ namespace Gecode { namespace FlatZinc {
       add(_node); add(_fail); add(_time);
       add(_mode);
       add(_print);
+      add(_profile);
     }
 
     void parse(int& argc, char* argv[]) {
@@ -237,6 +240,7 @@ namespace Gecode { namespace FlatZinc {
     unsigned int fail(void) const { return _fail.value(); }
     unsigned int time(void) const { return _time.value(); }
     unsigned int print(void) const { return _print.value(); }
+    bool profile(void) const { return _profile.value(); }
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
     }
@@ -257,6 +261,10 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
       Gecode::Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
       //@}
+      /// \name QuickXplain options
+      //@{
+      Gecode::Driver::UnsignedIntOption _jobs;      ///< Concurrent satisfiability checks
+      //@}
     
   public:
     enum SearchOptions {
@@ -273,13 +281,15 @@ namespace Gecode { namespace FlatZinc {
       _free("--free", "no need to follow search-specification"),
       _search("-search","search engine variant", FZ_SEARCH_BAB),
       _c_d("-c-d","recomputation commit distance",Gecode::Search::Config::c_d),
-      _a_d("-a-d","recomputation adaption distance",Gecode::Search::Config::a_d) {
+      _a_d("-a-d","recomputation adaption distance",Gecode::Search::Config::a_d),
+      _jobs("-jobs","number of concurrent satisfiability checks (0 = #processing units)",1) {
       _search.add(FZ_SEARCH_BAB, "bab");
       _search.add(FZ_SEARCH_RESTART, "restart");
       add(_threads); add(_c_d); add(_a_d);
       add(_parallel);
       add(_free);
       add(_search);
+      add(_jobs);
     }
 
     void parse(int& argc, char* argv[]) {
@@ -296,6 +306,7 @@ namespace Gecode { namespace FlatZinc {
     }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
+    unsigned int jobs(void) const { return _jobs.value(); }
   };
 
   /**
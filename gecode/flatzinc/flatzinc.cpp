@@ -44,6 +44,7 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <sstream>
 using namespace std;
 
 namespace Gecode { namespace FlatZinc {
@@ -121,6 +122,14 @@ namespace Gecode { namespace FlatZinc {
         return TieBreakVarBranch<IntVarBranch>(INT_VAR_SIZE_AFC_MIN);
       if (s->id == "size_afc_max")
         return TieBreakVarBranch<IntVarBranch>(INT_VAR_SIZE_AFC_MAX);
+      if (s->id == "activity_min")
+        return TieBreakVarBranch<IntVarBranch>(INT_VAR_ACTIVITY_MIN);
+      if (s->id == "activity_max")
+        return TieBreakVarBranch<IntVarBranch>(INT_VAR_ACTIVITY_MAX);
+      if (s->id == "size_activity_min")
+        return TieBreakVarBranch<IntVarBranch>(INT_VAR_SIZE_ACTIVITY_MIN);
+      if (s->id == "size_activity_max")
+        return TieBreakVarBranch<IntVarBranch>(INT_VAR_SIZE_ACTIVITY_MAX);
     }
     std::cerr << "Warning, ignored search annotation: ";
     ann->print(std::cerr);
@@ -743,6 +752,9 @@ namespace Gecode { namespace FlatZinc {
     }
 #endif
     StatusStatistics sstat;
+    PropagatorProfile* profile = 
+      (opt.mode() == SM_STAT) && opt.profile() ? new PropagatorProfile : NULL;
+    sstat.profile = profile;
     unsigned int n_p = 0;
     Support::Timer t_solve;
     t_solve.start();
@@ -755,6 +767,7 @@ namespace Gecode { namespace FlatZinc {
     o.c_d = opt.c_d();
     o.a_d = opt.a_d();
     o.threads = opt.threads();
+    o.profile = profile;
     Driver::Cutoff::installCtrlHandler(true);
     Engine<FlatZincSpace> se(this,o);
     int noOfSolutions = _method == SAT ? opt.solutions() : 0;
@@ -807,7 +820,18 @@ namespace Gecode { namespace FlatZinc {
            << "%%  peak memory:   "
            << static_cast<int>((stat.memory+1023) / 1024) << " KB"
            << endl;
+      if (profile != NULL) {
+        std::ostringstream os;
+        profile->print(os);
+        std::istringstream is(os.str());
+        std::string l;
+        out << "%%" << endl
+            << "%%  propagator profile:" << endl;
+        while (std::getline(is,l))
+          out << "%%  " << l << endl;
+      }
     }
+    delete profile;
   }
 
   template<template<class> class Engine>
@@ -1721,7 +1721,9 @@ namespace Gecode {
   enum ExtensionalPropKind {
     EPK_DEF,    ///< Make a default decision
     EPK_SPEED,  ///< Prefer speed over memory consumption
-    EPK_MEMORY  ///< Prefer little memory over speed
+    EPK_MEMORY, ///< Prefer little memory over speed
+    EPK_COMPACT, ///< Use compact tables (bitsets of tuples)
+    EPK_MDD      ///< Use a multi-valued decision diagram (layered graph)
   };
 
   /**
@@ -1794,6 +1796,41 @@ namespace Gecode {
       /// Pointer to NULL-pointer
       Tuple* nullpointer;
 
+      /**
+       * \brief Tuples that support a value at a position
+       *
+       * The tuples are represented by a bitset over the tuple
+       * numbers, where only the words from \a fst to \a lst
+       * (exclusive) can contain set bits and are stored.
+       */
+      class Supports {
+      public:
+        /// First word that is stored
+        unsigned int fst;
+        /// Last word that is stored plus one
+        unsigned int lst;
+        /// The stored words
+        Support::BitSetData* s;
+        /// Return word \a w of the bitset
+        Support::BitSetData word(unsigned int w) const;
+      };
+      /// Number of words for a bitset of all tuples
+      unsigned int n_words;
+      /// Supports for each position and value (computed on demand)
+      Supports* supports;
+      /// Words for the supports
+      Support::BitSetData* support_data;
+      /// Reduced multi-valued decision diagram (computed on demand)
+      DFA* mdd;
+      /// Mutex for computing the supports and the decision diagram
+      Support::Mutex support_m;
+      /// Compute supports if not yet done (requires finalization)
+      GECODE_INT_EXPORT void init_supports(void);
+      /// Return supports for value \a n at position \a i
+      const Supports& support(int i, int n) const;
+      /// Return decision diagram, compute if not yet done (requires finalization)
+      GECODE_INT_EXPORT const DFA& init_mdd(void);
+
       /// Add Tuple. Assumes that arity matches.
       template<class T>
       void add(T t);
@@ -1840,7 +1877,9 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports implementations optimized for memory (\a epk = \a
-   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED).
+   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED),
+   *     compact tables (\a epk = \a EPK_COMPACT), and multi-valued
+   *     decision diagrams (\a epk = \a EPK_MDD).
    * \li Supports domain consistency (\a icl = ICL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -1854,6 +1893,24 @@ namespace Gecode {
    * for the basic algorithm (\a epk = \a EPK_MEMORY) and additionally \f$
    * O\left(|x|^2\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
    * for the incremental algorithm (\a epk = \a EPK_SPEED).
+   *
+   * The compact-table algorithm (\a epk = \a EPK_COMPACT) keeps a
+   * bitset of the tuples that are still valid and uses a bitset of
+   * supporting tuples for each position and value. The latter are
+   * computed when the tuple set is first used by a compact-table
+   * propagator and are shared by all such propagators. If \a x
+   * contains the same unassigned variable multiply, the basic
+   * algorithm is used instead.
+   *
+   * The decision diagram algorithm (\a epk = \a EPK_MDD) compiles
+   * the tuple set into a reduced multi-valued decision diagram that
+   * is propagated by the same layered graph propagator as
+   * regular constraints (see extensional for DFAs). Tuple sets
+   * where many tuples share prefixes and suffixes result in much
+   * smaller diagrams. The diagram is computed when the tuple set
+   * is first used and is shared by all propagators. If \a x
+   * contains the same unassigned variable multiply, the basic
+   * algorithm is used instead.
    */
   GECODE_INT_EXPORT void
   extensional(Home home, const IntVarArgs& x, const TupleSet& t,
@@ -1862,7 +1919,9 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports implementations optimized for memory (\a epk = \a
-   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED).
+   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED),
+   *     compact tables (\a epk = \a EPK_COMPACT), and multi-valued
+   *     decision diagrams (\a epk = \a EPK_MDD).
    * \li Supports domain consistency (\a icl = ICL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -2288,6 +2347,8 @@ namespace Gecode {
     INT_VAR_DEGREE_MAX,      ///< With largest degree
     INT_VAR_AFC_MIN,         ///< With smallest accumulated failure count
     INT_VAR_AFC_MAX,         ///< With largest accumulated failure count
+    INT_VAR_ACTIVITY_MIN,    ///< With smallest activity
+    INT_VAR_ACTIVITY_MAX,    ///< With largest activity
     INT_VAR_MIN_MIN,         ///< With smallest min
     INT_VAR_MIN_MAX,         ///< With largest min
     INT_VAR_MAX_MIN,         ///< With smallest max
@@ -2298,6 +2359,8 @@ namespace Gecode {
     INT_VAR_SIZE_DEGREE_MAX, ///< With largest domain size divided by degree
     INT_VAR_SIZE_AFC_MIN,    ///< With smallest domain size divided by accumulated failure count
     INT_VAR_SIZE_AFC_MAX,    ///< With largest domain size divided by accumulated failure count
+    INT_VAR_SIZE_ACTIVITY_MIN, ///< With smallest domain size divided by activity
+    INT_VAR_SIZE_ACTIVITY_MAX, ///< With largest domain size divided by activity
     /** \brief With smallest min-regret
      *
      * The min-regret of a variable is the difference between the
@@ -47,6 +47,107 @@
 
 namespace Gecode { namespace Int { namespace Branch {
 
+  /*
+   * No-good literals
+   *
+   */
+
+  /// No-good literal for equality \f$x=n\f$
+  template<class View>
+  class EqNGL : public ViewValNGL<View,int,PC_INT_DOM> {
+  protected:
+    using ViewValNGL<View,int,PC_INT_DOM>::x;
+    using ViewValNGL<View,int,PC_INT_DOM>::n;
+  public:
+    /// Initialize for view \a x and value \a n
+    EqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    EqNGL(Space& home, bool share, EqNGL& ngl);
+    /// Test the status of the no-good literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the no-good literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+  };
+
+  /// No-good literal for disequality \f$x\neq n\f$
+  template<class View>
+  class NqNGL : public ViewValNGL<View,int,PC_INT_DOM> {
+  protected:
+    using ViewValNGL<View,int,PC_INT_DOM>::x;
+    using ViewValNGL<View,int,PC_INT_DOM>::n;
+  public:
+    /// Initialize for view \a x and value \a n
+    NqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    NqNGL(Space& home, bool share, NqNGL& ngl);
+    /// Test the status of the no-good literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the no-good literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+  };
+
+  /// No-good literal for less or equal \f$x\leq n\f$
+  template<class View>
+  class LqNGL : public ViewValNGL<View,int,PC_INT_BND> {
+  protected:
+    using ViewValNGL<View,int,PC_INT_BND>::x;
+    using ViewValNGL<View,int,PC_INT_BND>::n;
+  public:
+    /// Initialize for view \a x and value \a n
+    LqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    LqNGL(Space& home, bool share, LqNGL& ngl);
+    /// Test the status of the no-good literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the no-good literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+  };
+
+  /// No-good literal for equality \f$x=n\f$ for Boolean views
+  template<class View>
+  class BoolEqNGL : public ViewValNGL<View,int,PC_BOOL_VAL> {
+  protected:
+    using ViewValNGL<View,int,PC_BOOL_VAL>::x;
+    using ViewValNGL<View,int,PC_BOOL_VAL>::n;
+  public:
+    /// Initialize for view \a x and value \a n
+    BoolEqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    BoolEqNGL(Space& home, bool share, BoolEqNGL& ngl);
+    /// Test the status of the no-good literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the no-good literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+  };
+
+  /// No-good literal for greater or equal \f$x\geq n\f$
+  template<class View>
+  class GqNGL : public ViewValNGL<View,int,PC_INT_BND> {
+  protected:
+    using ViewValNGL<View,int,PC_INT_BND>::x;
+    using ViewValNGL<View,int,PC_INT_BND>::n;
+  public:
+    /// Initialize for view \a x and value \a n
+    GqNGL(Space& home, View x, int n);
+    /// Constructor for cloning \a ngl
+    GqNGL(Space& home, bool share, GqNGL& ngl);
+    /// Test the status of the no-good literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the no-good literal
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+  };
+
+
   /*
    * Value selection classes
    *
@@ -70,6 +171,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x=n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for alternative \a a
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
   /**
@@ -90,6 +193,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x=n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for alternative \a a
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
   /**
@@ -121,6 +226,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, _View x);
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, _View x, int n);
+    /// Return no-good literal for alternative \a a
+    NGL* ngl(Space& home, unsigned int a, _View x, int n) const;
     /// Return choice
     Support::RandomGenerator choice(Space& home);
     /// Commit to choice
@@ -150,6 +257,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x >n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for alternative \a a
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
 
@@ -172,6 +281,8 @@ namespace Gecode { namespace Int { namespace Branch {
     int val(Space& home, View x) const;
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x >n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, int n);
+    /// Return no-good literal for alternative \a a
+    NGL* ngl(Space& home, unsigned int a, View x, int n) const;
   };
 
 
@@ -196,6 +307,8 @@ namespace Gecode { namespace Int { namespace Branch {
     NoValue val(Space& home, View x) const;
     /// Tell \f$x=0\f$ (\a a = 0) or \f$x=1\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, View x, NoValue n);
+    /// Return no-good literal for alternative \a a
+    NGL* ngl(Space& home, unsigned int a, View x, NoValue n) const;
   };
 
 
@@ -491,6 +604,48 @@ namespace Gecode { namespace Int { namespace Branch {
     ViewSelStatus select(Space& home, IntView x);
   };
 
+  /**
+   * \brief View selection class for view with smallest size divided by activity
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeActivityMin : public ViewSelBase<IntView> {
+  protected:
+    /// So-far smallest size/activity
+    double sizeact;
+  public:
+    /// Default constructor
+    BySizeActivityMin(void);
+    /// Constructor for initialization
+    BySizeActivityMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x
+    ViewSelStatus init(Space& home, IntView x);
+    /// Possibly select better view \a x
+    ViewSelStatus select(Space& home, IntView x);
+  };
+
+  /**
+   * \brief View selection class for view with largest size divided by activity
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeActivityMax : public ViewSelBase<IntView> {
+  protected:
+    /// So-far largest size/activity
+    double sizeact;
+  public:
+    /// Default constructor
+    BySizeActivityMax(void);
+    /// Constructor for initialization
+    BySizeActivityMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x
+    ViewSelStatus init(Space& home, IntView x);
+    /// Possibly select better view \a x
+    ViewSelStatus select(Space& home, IntView x);
+  };
+
   /**
    * \brief View selection class for view with smallest min-regret
    *
@@ -577,6 +732,7 @@ namespace Gecode { namespace Int { namespace Branch {
 
 }}}
 
+#include <gecode/int/branch/ngl.hpp>
 #include <gecode/int/branch/select-val.hpp>
 #include <gecode/int/branch/select-values.hpp>
 #include <gecode/int/branch/select-view.hpp>
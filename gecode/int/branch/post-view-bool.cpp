@@ -82,6 +82,12 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_AFC_MAX:
       v = new (home) ViewSelVirtual<ViewSelAfcMax<BoolView> >(home,o_vars);
       break;
+    case INT_VAR_ACTIVITY_MIN:
+      v = new (home) ViewSelVirtual<ViewSelActivityMin<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_ACTIVITY_MAX:
+      v = new (home) ViewSelVirtual<ViewSelActivityMax<BoolView> >(home,o_vars);
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       v = new (home) ViewSelVirtual<ViewSelDegreeMax<BoolView> >(home,o_vars);
       break;
@@ -94,6 +100,12 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_SIZE_AFC_MAX:
       v = new (home) ViewSelVirtual<ViewSelAfcMin<BoolView> >(home,o_vars);
       break;
+    case INT_VAR_SIZE_ACTIVITY_MIN:
+      v = new (home) ViewSelVirtual<ViewSelActivityMax<BoolView> >(home,o_vars);
+      break;
+    case INT_VAR_SIZE_ACTIVITY_MAX:
+      v = new (home) ViewSelVirtual<ViewSelActivityMin<BoolView> >(home,o_vars);
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       v = new (home) ViewSelVirtual<ViewSelNone<BoolView> >(home,o_vars);
       break;
@@ -200,6 +212,18 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.bf);
       }
       break;
+    case INT_VAR_ACTIVITY_MIN:
+      {
+        ViewSelActivityMin<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
+    case INT_VAR_ACTIVITY_MAX:
+      {
+        ViewSelActivityMax<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       {
         ViewSelDegreeMax<BoolView> v(home,o_vars);
@@ -224,6 +248,18 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.bf);
       }
       break;
+    case INT_VAR_SIZE_ACTIVITY_MIN:
+      {
+        ViewSelActivityMax<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
+    case INT_VAR_SIZE_ACTIVITY_MAX:
+      {
+        ViewSelActivityMin<BoolView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       {
         ViewSelNone<BoolView> v(home,o_vars);
@@ -362,6 +398,22 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.a.bf);
       }
       break;
+    case INT_VAR_ACTIVITY_MIN:
+      {
+        ViewSelActivityMin<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMin<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
+    case INT_VAR_ACTIVITY_MAX:
+      {
+        ViewSelActivityMax<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMax<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       {
         ViewSelDegreeMax<BoolView> va(home,o_vars.a);
@@ -394,6 +446,22 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.a.bf);
       }
       break;
+    case INT_VAR_SIZE_ACTIVITY_MIN:
+      {
+        ViewSelActivityMax<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMax<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
+    case INT_VAR_SIZE_ACTIVITY_MAX:
+      {
+        ViewSelActivityMin<BoolView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMin<BoolView>,
+          ViewSelTieBreakDynamic<BoolView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       {
         ViewSelNone<BoolView> va(home,o_vars.a);
@@ -82,6 +82,12 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_AFC_MAX:
       v = new (home) ViewSelVirtual<ViewSelAfcMax<IntView> >(home,o_vars);
       break;
+    case INT_VAR_ACTIVITY_MIN:
+      v = new (home) ViewSelVirtual<ViewSelActivityMin<IntView> >(home,o_vars);
+      break;
+    case INT_VAR_ACTIVITY_MAX:
+      v = new (home) ViewSelVirtual<ViewSelActivityMax<IntView> >(home,o_vars);
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       v = new (home) ViewSelVirtual<BySizeDegreeMin>(home,o_vars);
       break;
@@ -94,6 +100,12 @@ namespace Gecode { namespace Int { namespace Branch {
     case INT_VAR_SIZE_AFC_MAX:
       v = new (home) ViewSelVirtual<BySizeAfcMax>(home,o_vars);
       break;
+    case INT_VAR_SIZE_ACTIVITY_MIN:
+      v = new (home) ViewSelVirtual<BySizeActivityMin>(home,o_vars);
+      break;
+    case INT_VAR_SIZE_ACTIVITY_MAX:
+      v = new (home) ViewSelVirtual<BySizeActivityMax>(home,o_vars);
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       v = new (home) ViewSelVirtual<ByRegretMinMin>(home,o_vars);
       break;
@@ -200,6 +212,18 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.bf);
       }
       break;
+    case INT_VAR_ACTIVITY_MIN:
+      {
+        ViewSelActivityMin<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
+    case INT_VAR_ACTIVITY_MAX:
+      {
+        ViewSelActivityMax<IntView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       {
         BySizeDegreeMin v(home,o_vars);
@@ -224,6 +248,18 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.bf);
       }
       break;
+    case INT_VAR_SIZE_ACTIVITY_MIN:
+      {
+        BySizeActivityMin v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
+    case INT_VAR_SIZE_ACTIVITY_MAX:
+      {
+        BySizeActivityMax v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       {
         ByRegretMinMin v(home,o_vars);
@@ -362,6 +398,22 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.a.bf);
       }
       break;
+    case INT_VAR_ACTIVITY_MIN:
+      {
+        ViewSelActivityMin<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMin<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
+    case INT_VAR_ACTIVITY_MAX:
+      {
+        ViewSelActivityMax<IntView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMax<IntView>,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
     case INT_VAR_SIZE_DEGREE_MIN:
       {
         BySizeDegreeMin va(home,o_vars.a);
@@ -394,6 +446,22 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.a.bf);
       }
       break;
+    case INT_VAR_SIZE_ACTIVITY_MIN:
+      {
+        BySizeActivityMin va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeActivityMin,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
+    case INT_VAR_SIZE_ACTIVITY_MAX:
+      {
+        BySizeActivityMax va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeActivityMax,
+          ViewSelTieBreakDynamic<IntView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
     case INT_VAR_REGRET_MIN_MIN:
       {
         ByRegretMinMin va(home,o_vars.a);
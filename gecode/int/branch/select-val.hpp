@@ -54,6 +54,14 @@ namespace Gecode { namespace Int { namespace Branch {
   ValMin<View>::tell(Space& home, unsigned int a, View x, int n) {
     return (a == 0) ? x.eq(home,n) : x.gr(home,n);
   }
+  template<class View>
+  forceinline NGL*
+  ValMin<View>::ngl(Space& home, unsigned int a, View x, int n) const {
+    if (a == 0)
+      return new (home) EqNGL<View>(home,x,n);
+    else
+      return new (home) GqNGL<View>(home,x,n+1);
+  }
 
   template<class View>
   forceinline
@@ -72,6 +80,14 @@ namespace Gecode { namespace Int { namespace Branch {
   ValMed<View>::tell(Space& home, unsigned int a, View x, int n) {
     return (a == 0) ? x.eq(home,n) : x.nq(home,n);
   }
+  template<class View>
+  forceinline NGL*
+  ValMed<View>::ngl(Space& home, unsigned int a, View x, int n) const {
+    if (a == 0)
+      return new (home) EqNGL<View>(home,x,n);
+    else
+      return new (home) NqNGL<View>(home,x,n);
+  }
 
 
   template<class View>
@@ -99,6 +115,14 @@ namespace Gecode { namespace Int { namespace Branch {
     return (a == 0) ? x.eq(home,n) : x.nq(home,n);
   }
   template<class View>
+  forceinline NGL*
+  ValRnd<View>::ngl(Space& home, unsigned int a, View x, int n) const {
+    if (a == 0)
+      return new (home) EqNGL<View>(home,x,n);
+    else
+      return new (home) NqNGL<View>(home,x,n);
+  }
+  template<class View>
   forceinline Support::RandomGenerator
   ValRnd<View>::choice(Space&) {
     return r;
@@ -137,6 +161,14 @@ namespace Gecode { namespace Int { namespace Branch {
   ValSplitMin<View>::tell(Space& home, unsigned int a, View x, int n) {
     return (a == 0) ? x.lq(home,n) : x.gr(home,n);
   }
+  template<class View>
+  forceinline NGL*
+  ValSplitMin<View>::ngl(Space& home, unsigned int a, View x, int n) const {
+    if (a == 0)
+      return new (home) LqNGL<View>(home,x,n);
+    else
+      return new (home) GqNGL<View>(home,x,n+1);
+  }
 
 
   template<class View>
@@ -162,6 +194,14 @@ namespace Gecode { namespace Int { namespace Branch {
   ValRangeMin<View>::tell(Space& home, unsigned int a, View x, int n) {
     return (a == 0) ? x.lq(home,n) : x.gr(home,n);
   }
+  template<class View>
+  forceinline NGL*
+  ValRangeMin<View>::ngl(Space& home, unsigned int a, View x, int n) const {
+    if (a == 0)
+      return new (home) LqNGL<View>(home,x,n);
+    else
+      return new (home) GqNGL<View>(home,x,n+1);
+  }
 
 
   template<class View>
@@ -181,6 +221,11 @@ namespace Gecode { namespace Int { namespace Branch {
   ValZeroOne<View>::tell(Space& home, unsigned int a, View x, NoValue) {
     return (a == 0) ? x.zero(home) : x.one(home);
   }
+  template<class View>
+  forceinline NGL*
+  ValZeroOne<View>::ngl(Space& home, unsigned int a, View x, NoValue) const {
+    return new (home) BoolEqNGL<View>(home,x,static_cast<int>(a));
+  }
 
 
   template<class View>
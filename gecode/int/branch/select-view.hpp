@@ -267,6 +267,66 @@ namespace Gecode { namespace Int { namespace Branch {
     }
   }
 
+  // Select variable with smallest size/activity
+  forceinline
+  BySizeActivityMin::BySizeActivityMin(void) : sizeact(0) {}
+  forceinline
+  BySizeActivityMin::BySizeActivityMin(Space& home,
+                                       const VarBranchOptions& vbo)
+    : ViewSelBase<IntView>(home,vbo), sizeact(0) {
+#ifndef GECODE_HAS_ACTIVITY
+    throw ActivityDisabled("Int::Branch::BySizeActivityMin");
+#endif
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMin::init(Space& home, View x) {
+    x.activity(home);
+    sizeact = static_cast<double>(x.size())/x.activity();
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMin::select(Space& home, View x) {
+    x.activity(home);
+    double sa = static_cast<double>(x.size())/x.activity();
+    if (sa < sizeact) {
+      sizeact = sa; return VSS_BETTER;
+    } else if (sa > sizeact) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+
+  // Select variable with largest size/activity
+  forceinline
+  BySizeActivityMax::BySizeActivityMax(void) : sizeact(0) {}
+  forceinline
+  BySizeActivityMax::BySizeActivityMax(Space& home,
+                                       const VarBranchOptions& vbo)
+    : ViewSelBase<IntView>(home,vbo), sizeact(0) {
+#ifndef GECODE_HAS_ACTIVITY
+    throw ActivityDisabled("Int::Branch::BySizeActivityMax");
+#endif
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMax::init(Space& home, View x) {
+    x.activity(home);
+    sizeact = static_cast<double>(x.size())/x.activity();
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMax::select(Space& home, View x) {
+    x.activity(home);
+    double sa = static_cast<double>(x.size())/x.activity();
+    if (sa > sizeact) {
+      sizeact = sa; return VSS_BETTER;
+    } else if (sa < sizeact) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+
   // Select variable with smallest min-regret
   forceinline
   ByRegretMinMin::ByRegretMinMin(void) : regret(0U) {}
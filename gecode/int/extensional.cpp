@@ -78,6 +78,25 @@ namespace Gecode {
       GECODE_ES_FAIL((Extensional::Incremental<IntView>
                            ::post(home,xv,t)));
       break;
+    case EPK_COMPACT:
+      if (x.same(home)) {
+        GECODE_ES_FAIL((Extensional::Basic<IntView,true>
+                             ::post(home,xv,t)));
+      } else {
+        GECODE_ES_FAIL((Extensional::CompactTable<IntView>
+                             ::post(home,xv,t)));
+      }
+      break;
+    case EPK_MDD:
+      if (x.same(home)) {
+        GECODE_ES_FAIL((Extensional::Basic<IntView,true>
+                             ::post(home,xv,t)));
+      } else {
+        TupleSet ts(t);
+        GECODE_ES_FAIL(Extensional::post_lgp(home,x,
+                                             ts.implementation()->init_mdd()));
+      }
+      break;
     default:
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<IntView,true>
@@ -107,6 +126,25 @@ namespace Gecode {
       GECODE_ES_FAIL((Extensional::Incremental<BoolView>
                            ::post(home,xv,t)));
       break;
+    case EPK_COMPACT:
+      if (x.same(home)) {
+        GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
+                             ::post(home,xv,t)));
+      } else {
+        GECODE_ES_FAIL((Extensional::CompactTable<BoolView>
+                             ::post(home,xv,t)));
+      }
+      break;
+    case EPK_MDD:
+      if (x.same(home)) {
+        GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
+                             ::post(home,xv,t)));
+      } else {
+        TupleSet ts(t);
+        GECODE_ES_FAIL(Extensional::post_lgp(home,x,
+                                             ts.implementation()->init_mdd()));
+      }
+      break;
     default:
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
@@ -502,6 +502,129 @@ namespace Gecode { namespace Int { namespace Extensional {
 #include <gecode/int/extensional/incremental.hpp>
 
 
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /**
+   * \brief Sparse bitset of valid tuples
+   *
+   * Only the words that contain set bits are stored, together with
+   * their position in the full bitset. Removing a word swaps it with
+   * the last stored word, and copying copies only the stored words.
+   */
+  class TupleBitSet {
+  protected:
+    /// Number of stored words
+    int limit;
+    /// Position of the stored words in the full bitset
+    int* index;
+    /// The stored words
+    Support::BitSetData* bits;
+    /// Remove stored word \a k
+    void remove(int k);
+  public:
+    /// Default constructor (no initialization)
+    TupleBitSet(void);
+    /// Initialize with \a n bits set
+    void init(Space& home, unsigned int n);
+    /// Update during cloning from \a s
+    void update(Space& home, TupleBitSet& s);
+    /// Test whether no bit is set
+    bool empty(void) const;
+    /// Return number of stored words
+    int words(void) const;
+    /**
+     * \brief Test whether some bit is also set in \a s
+     *
+     * The stored word \a r (the residue) is tested first. Otherwise,
+     * all stored words are tested and \a r is set to a word that
+     * intersects with \a s (if any).
+     */
+    bool intersects(const TupleSet::TupleSetI::Supports& s, int& r) const;
+    /// Keep only the bits also set in \a s
+    void intersect(const TupleSet::TupleSetI::Supports& s);
+    /// Clear the bits set in \a s
+    void remove(const TupleSet::TupleSetI::Supports& s);
+    /// Add the bits in \a s to the mask \a m for the stored words
+    void add_to_mask(Support::BitSetData* m,
+                     const TupleSet::TupleSetI::Supports& s) const;
+    /// Keep only the bits set in the mask \a m for the stored words
+    void intersect(const Support::BitSetData* m);
+  };
+
+  /**
+   * \brief Domain consistent compact-table extensional propagator
+   *
+   * The propagator maintains a bitset of the tuples that are valid
+   * with respect to the current domains. Advisors update the bitset
+   * with precomputed bitsets of the tuples that support each value.
+   * Propagation removes all values whose supports do not intersect
+   * with the valid tuples. The algorithm is based on:
+   *   Jordan Demeulenaere, Renaud Hartert, Christophe Lecoutre,
+   *   Guillaume Perez, Laurent Perron, Jean-Charles R\'egin, Pierre
+   *   Schaus, Compact-Table: Efficiently Filtering Table Constraints
+   *   with Reversible Sparse Bit-Sets, CP 2016.
+   *
+   * The propagator is not capable of dealing with multiple occurences
+   * of the same view.
+   *
+   * Requires \code #include <gecode/int/extensional.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class CompactTable : public Propagator {
+  protected:
+    /// %Advisors for views (by position in array)
+    class Index : public Advisor {
+    public:
+      /// The position of the view in the view array
+      int i;
+      /// Create index advisor
+      Index(Space& home, Propagator& p, Council<Index>& c, int i);
+      /// Clone index advisor \a a
+      Index(Space& home, bool share, Index& a);
+    };
+    /// The advisor council
+    Council<Index> c;
+    /// The views
+    ViewArray<View> x;
+    /// Definition of constraint
+    TupleSet tupleSet;
+    /// Valid tuples
+    TupleBitSet table;
+    /// Residues: stored word of last support for each position and value
+    int* residues;
+    /// Whether the propagator is currently pruning the views
+    bool pruning;
+    /// Access real tuple-set
+    TupleSet::TupleSetI* ts(void);
+    /// Return residue for value \a n of view \a i
+    int& residue(int i, int n);
+    /// Keep only the tuples valid for the domain of view \a i
+    void reset(Space& home, int i);
+    /// Constructor for cloning \a p
+    CompactTable(Space& home, bool share, CompactTable<View>& p);
+    /// Constructor for posting
+    CompactTable(Home home, ViewArray<View>& x, const TupleSet& t);
+  public:
+    /// Cost function (defined as high linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for views \a x
+    static ExecStatus post(Home home, ViewArray<View>& x, const TupleSet& t);
+  };
+
+}}}
+
+#include <gecode/int/extensional/compact-table.hpp>
+
+
 #endif
 
 // STATISTICS: int-prop
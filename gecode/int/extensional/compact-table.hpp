@@ -0,0 +1,322 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /*
+   * Sparse bitsets of tuples
+   *
+   */
+
+  forceinline
+  TupleBitSet::TupleBitSet(void) {}
+
+  forceinline void
+  TupleBitSet::init(Space& home, unsigned int n) {
+    limit = static_cast<int>(Support::BitSetData::data(n));
+    index = home.alloc<int>(limit);
+    bits = home.alloc<Support::BitSetData>(limit);
+    for (int k = limit; k--; ) {
+      index[k] = k; bits[k].init(true);
+    }
+    // Clear the bits in the last word that do not correspond to tuples
+    for (unsigned int b = n % Support::BitSetData::bpb;
+         (b > 0) && (b < Support::BitSetData::bpb); b++)
+      bits[limit-1].clear(b);
+  }
+
+  forceinline void
+  TupleBitSet::update(Space& home, TupleBitSet& s) {
+    limit = s.limit;
+    index = home.alloc<int>(limit);
+    bits = home.alloc<Support::BitSetData>(limit);
+    for (int k = limit; k--; ) {
+      index[k] = s.index[k]; bits[k] = s.bits[k];
+    }
+  }
+
+  forceinline void
+  TupleBitSet::remove(int k) {
+    limit--;
+    index[k] = index[limit]; bits[k] = bits[limit];
+  }
+
+  forceinline bool
+  TupleBitSet::empty(void) const {
+    return limit == 0;
+  }
+
+  forceinline int
+  TupleBitSet::words(void) const {
+    return limit;
+  }
+
+  forceinline bool
+  TupleBitSet::intersects(const TupleSet::TupleSetI::Supports& s,
+                          int& r) const {
+    if (s.fst == s.lst)
+      return false;
+    // Test the residue first
+    if ((r < limit) &&
+        !bits[r].disjoint(s.word(static_cast<unsigned int>(index[r]))))
+      return true;
+    for (int k = limit; k--; ) {
+      unsigned int w = static_cast<unsigned int>(index[k]);
+      if ((w >= s.fst) && (w < s.lst) && !bits[k].disjoint(s.s[w-s.fst])) {
+        r = k; return true;
+      }
+    }
+    return false;
+  }
+
+  forceinline void
+  TupleBitSet::intersect(const TupleSet::TupleSetI::Supports& s) {
+    for (int k = limit; k--; ) {
+      bits[k].a(s.word(static_cast<unsigned int>(index[k])));
+      if (bits[k].none())
+        remove(k);
+    }
+  }
+
+  forceinline void
+  TupleBitSet::remove(const TupleSet::TupleSetI::Supports& s) {
+    if (s.fst == s.lst)
+      return;
+    for (int k = limit; k--; ) {
+      unsigned int w = static_cast<unsigned int>(index[k]);
+      if ((w >= s.fst) && (w < s.lst)) {
+        bits[k].c(s.s[w-s.fst]);
+        if (bits[k].none())
+          remove(k);
+      }
+    }
+  }
+
+  forceinline void
+  TupleBitSet::add_to_mask(Support::BitSetData* m,
+                           const TupleSet::TupleSetI::Supports& s) const {
+    if (s.fst == s.lst)
+      return;
+    for (int k = limit; k--; ) {
+      unsigned int w = static_cast<unsigned int>(index[k]);
+      if ((w >= s.fst) && (w < s.lst))
+        m[k].o(s.s[w-s.fst]);
+    }
+  }
+
+  forceinline void
+  TupleBitSet::intersect(const Support::BitSetData* m) {
+    // Removing a word moves an already processed word to position k
+    for (int k = limit; k--; ) {
+      bits[k].a(m[k]);
+      if (bits[k].none())
+        remove(k);
+    }
+  }
+
+
+  /*
+   * Advisors
+   *
+   */
+
+  template<class View>
+  forceinline
+  CompactTable<View>::Index::Index(Space& home, Propagator& p,
+                                   Council<Index>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  template<class View>
+  forceinline
+  CompactTable<View>::Index::Index(Space& home, bool share, Index& a)
+    : Advisor(home,share,a), i(a.i) {}
+
+
+  /*
+   * The propagator proper
+   *
+   */
+
+  template<class View>
+  forceinline TupleSet::TupleSetI*
+  CompactTable<View>::ts(void) {
+    return tupleSet.implementation();
+  }
+
+  template<class View>
+  forceinline int&
+  CompactTable<View>::residue(int i, int n) {
+    return residues[i*static_cast<int>(ts()->domsize) + (n-ts()->min)];
+  }
+
+  template<class View>
+  forceinline
+  CompactTable<View>::CompactTable(Home home, ViewArray<View>& x0,
+                                   const TupleSet& t)
+    : Propagator(home), c(home), x(x0), tupleSet(t), pruning(false) {
+    assert(ts()->finalized());
+    ts()->init_supports();
+    table.init(home,static_cast<unsigned int>(tupleSet.tuples()));
+    int n = x.size()*static_cast<int>(ts()->domsize);
+    residues = static_cast<Space&>(home).alloc<int>(n);
+    for (int j = n; j--; )
+      residues[j] = 0;
+    for (int i = x.size(); i--; )
+      if (!x[i].assigned())
+        x[i].subscribe(home, *new (home) Index(home,*this,c,i));
+    View::schedule(home,*this,ME_INT_VAL);
+    home.notice(*this,AP_DISPOSE);
+  }
+
+  template<class View>
+  forceinline
+  CompactTable<View>::CompactTable(Space& home, bool share,
+                                   CompactTable<View>& p)
+    : Propagator(home,share,p), pruning(false) {
+    c.update(home,share,p.c);
+    x.update(home,share,p.x);
+    tupleSet.update(home,share,p.tupleSet);
+    table.update(home,p.table);
+    int n = x.size()*static_cast<int>(ts()->domsize);
+    residues = home.alloc<int>(n);
+    for (int j = n; j--; )
+      residues[j] = p.residues[j];
+  }
+
+  template<class View>
+  void
+  CompactTable<View>::reset(Space& home, int i) {
+    Region r(home);
+    Support::BitSetData* m = r.alloc<Support::BitSetData>(table.words());
+    for (int k = table.words(); k--; )
+      m[k].init(false);
+    for (ViewValues<View> vv(x[i]); vv(); ++vv)
+      table.add_to_mask(m,ts()->support(i,vv.val()));
+    table.intersect(m);
+  }
+
+  template<class View>
+  ExecStatus
+  CompactTable<View>::post(Home home, ViewArray<View>& x,
+                           const TupleSet& t) {
+    // All variables in the correct domain
+    for (int i = x.size(); i--; ) {
+      GECODE_ME_CHECK(x[i].gq(home, t.min()));
+      GECODE_ME_CHECK(x[i].lq(home, t.max()));
+    }
+    CompactTable<View>* p = new (home) CompactTable<View>(home,x,t);
+    for (int i = x.size(); i--; )
+      p->reset(home,i);
+    return p->table.empty() ? ES_FAILED : ES_OK;
+  }
+
+  template<class View>
+  PropCost
+  CompactTable<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::HI,x.size());
+  }
+
+  template<class View>
+  ExecStatus
+  CompactTable<View>::advise(Space& home, Advisor& _a, const Delta& d) {
+    Index& a = static_cast<Index&>(_a);
+    const int i = a.i;
+
+    // Values removed by the propagator do not support any valid tuple
+    if (pruning)
+      return x[i].assigned() ? home.ES_FIX_DISPOSE(c,a) : ES_FIX;
+
+    if (x[i].assigned()) {
+      table.intersect(ts()->support(i,x[i].val()));
+    } else if (!x[i].any(d) && 
+               (static_cast<unsigned int>(x[i].max(d)-x[i].min(d)) 
+                < x[i].size())) {
+      // Fewer values removed than left
+      for (int n = x[i].min(d); n <= x[i].max(d); n++)
+        table.remove(ts()->support(i,n));
+    } else {
+      reset(home,i);
+    }
+
+    if (table.empty())
+      return ES_FAILED;
+    return x[i].assigned() ? home.ES_NOFIX_DISPOSE(c,a) : ES_NOFIX;
+  }
+
+  template<class View>
+  ExecStatus
+  CompactTable<View>::propagate(Space& home, const ModEventDelta&) {
+    Region r(home);
+    // Values to prune
+    Support::StaticStack<int,Region> nq(r,static_cast<int>(ts()->domsize));
+
+    pruning = true;
+    for (int i = x.size(); i--; )
+      if (!x[i].assigned()) {
+        for (ViewValues<View> vv(x[i]); vv(); ++vv)
+          if (!table.intersects(ts()->support(i,vv.val()),
+                                residue(i,vv.val())))
+            nq.push(vv.val());
+        while (!nq.empty())
+          GECODE_ME_CHECK(x[i].nq(home,nq.pop()));
+      }
+    pruning = false;
+
+    for (int i = x.size(); i--; )
+      if (!x[i].assigned())
+        return ES_FIX;
+    return home.ES_SUBSUMED(*this);
+  }
+
+  template<class View>
+  Actor*
+  CompactTable<View>::copy(Space& home, bool share) {
+    return new (home) CompactTable<View>(home,share,*this);
+  }
+
+  template<class View>
+  forceinline size_t
+  CompactTable<View>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    c.dispose(home);
+    (void) tupleSet.~TupleSet();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -88,6 +88,40 @@ namespace {
     }
   };
 
+  /**
+   * \brief Compare nodes of a decision diagram by their outgoing edges
+   *
+   * The edges of node \f$n\f$ are stored from \a fst[n] to \a
+   * fst[n+1]-1 and are sorted by symbol.
+   */
+  class NodeCompare {
+  private:
+    /// First edge for each node
+    const int* fst;
+    /// Symbol for each edge
+    const int* sym;
+    /// Target node for each edge
+    const int* dst;
+  public:
+    /// Initialize with edge information
+    forceinline
+    NodeCompare(const int* f, const int* s, const int* d)
+      : fst(f), sym(s), dst(d) {}
+    /// Strict lexicographic comparison of edges of nodes \a a and \a b
+    forceinline bool
+    operator ()(const int& a, const int& b) {
+      int i = fst[a], j = fst[b];
+      while ((i < fst[a+1]) && (j < fst[b+1])) {
+        if (sym[i] != sym[j])
+          return sym[i] < sym[j];
+        if (dst[i] != dst[j])
+          return dst[i] < dst[j];
+        i++; j++;
+      }
+      return (i == fst[a+1]) && (j < fst[b+1]);
+    }
+  };
+
 }
 
 namespace Gecode {
@@ -161,6 +195,151 @@ namespace Gecode {
     assert(finalized());
   }
 
+  void
+  TupleSet::TupleSetI::init_supports(void) {
+    assert(finalized());
+    Support::Lock l(support_m);
+    if (supports != NULL)
+      return;
+    // The last tuple is the largest tuple added by finalize
+    unsigned int n = static_cast<unsigned int>(size-1);
+    unsigned int bpb = Support::BitSetData::bpb;
+    n_words = Support::BitSetData::data(n);
+    Supports* s = heap.alloc<Supports>(domsize*arity);
+    // Tuples with the same value at position i are consecutive in
+    // tuples[i] and sorted by tuple number
+    unsigned int n_data = 0;
+    for (int i = arity; i--; )
+      for (unsigned int d = domsize; d--; ) {
+        Supports& sd = s[i*domsize + d];
+        Tuple* t = last[i*domsize + d];
+        if (*t == NULL) {
+          sd.fst = sd.lst = 0;
+        } else {
+          int v = (*t)[i];
+          sd.fst = static_cast<unsigned int>((*t - data) / arity) / bpb;
+          while ((*(t+1) != NULL) && ((*(t+1))[i] == v))
+            t++;
+          sd.lst = static_cast<unsigned int>((*t - data) / arity) / bpb + 1;
+        }
+        n_data += sd.lst - sd.fst;
+      }
+    support_data = heap.alloc<Support::BitSetData>(n_data);
+    for (unsigned int w = n_data; w--; )
+      support_data[w].init(false);
+    Support::BitSetData* sd = support_data;
+    for (int i = arity; i--; )
+      for (unsigned int d = domsize; d--; ) {
+        Supports& si = s[i*domsize + d];
+        si.s = sd; sd += si.lst - si.fst;
+        if (si.lst > si.fst) {
+          Tuple* t = last[i*domsize + d];
+          int v = (*t)[i];
+          do {
+            unsigned int k = static_cast<unsigned int>((*t - data) / arity);
+            si.s[k / bpb - si.fst].set(k % bpb);
+            t++;
+          } while ((*t != NULL) && ((*t)[i] == v));
+        }
+      }
+    supports = s;
+  }
+
+  const DFA&
+  TupleSet::TupleSetI::init_mdd(void) {
+    assert(finalized());
+    Support::Lock l(support_m);
+    if (mdd != NULL)
+      return *mdd;
+    // The last tuple is the largest tuple added by finalize
+    int n = size-1;
+    /*
+     * The tuples are sorted lexicographically. Hence the nodes at
+     * level i of the trie of all tuples correspond to runs of tuples
+     * with the same prefix of length i. The trie is reduced bottom-up
+     * level by level: nodes with the same outgoing edges are merged.
+     */
+    // Length of common prefix of tuple t with tuple t-1
+    int* lcp = heap.alloc<int>(n);
+    for (int t = n; t-- > 1; ) {
+      const int* a = data + (t-1)*arity;
+      const int* b = data + t*arity;
+      int i = 0;
+      while ((i < arity) && (a[i] == b[i]))
+        i++;
+      lcp[t] = i;
+    }
+    if (n > 0)
+      lcp[0] = -1;
+    // Reduced node reached by tuple t at the current level
+    int* node = heap.alloc<int>(n);
+    // First tuple of each node at current level
+    int* t_fst = heap.alloc<int>(n+1);
+    // First edge, symbol, and target per node at current level
+    int* e_fst = heap.alloc<int>(n+1);
+    int* sym = heap.alloc<int>(n);
+    int* dst = heap.alloc<int>(n);
+    // Nodes sorted by edges and their reduced node
+    int* order = heap.alloc<int>(n);
+    int* red = heap.alloc<int>(n);
+    DFA::Transition* trans = heap.alloc<DFA::Transition>(n*arity+1);
+    int n_trans = 0;
+    // State 0 is the only final state
+    int n_states = 1;
+    for (int t = n; t--; )
+      node[t] = 0;
+    for (int i = arity; i--; ) {
+      // Collect nodes at level i and their edges
+      int n_nodes = 0, n_edges = 0;
+      for (int t = 0; t < n; t++) {
+        if (lcp[t] < i) {
+          t_fst[n_nodes] = t; e_fst[n_nodes++] = n_edges;
+        }
+        if (lcp[t] < i+1) {
+          sym[n_edges] = data[t*arity+i]; dst[n_edges++] = node[t];
+        }
+      }
+      t_fst[n_nodes] = n; e_fst[n_nodes] = n_edges;
+      // Merge nodes with the same edges
+      for (int k = n_nodes; k--; )
+        order[k] = k;
+      NodeCompare nc(e_fst,sym,dst);
+      Support::quicksort(order,n_nodes,nc);
+      for (int k = 0; k < n_nodes; k++) {
+        if ((k == 0) || nc(order[k-1],order[k])) {
+          for (int e = e_fst[order[k]]; e < e_fst[order[k]+1]; e++) {
+            trans[n_trans].i_state = n_states;
+            trans[n_trans].symbol  = sym[e];
+            trans[n_trans].o_state = dst[e];
+            n_trans++;
+          }
+          n_states++;
+        }
+        red[order[k]] = n_states-1;
+      }
+      for (int k = n_nodes; k--; )
+        for (int t = t_fst[k]; t < t_fst[k+1]; t++)
+          node[t] = red[k];
+    }
+    trans[n_trans].i_state = -1;
+    trans[n_trans].symbol  = -1;
+    trans[n_trans].o_state = -1;
+    int final[] = {0, -1};
+    // Without tuples, the start state has no transitions and is not final
+    int start = (n > 0) ? node[0] : n_states;
+    mdd = new DFA(start,trans,final,false);
+    heap.free<DFA::Transition>(trans,n*arity+1);
+    heap.free<int>(red,n);
+    heap.free<int>(order,n);
+    heap.free<int>(dst,n);
+    heap.free<int>(sym,n);
+    heap.free<int>(e_fst,n+1);
+    heap.free<int>(t_fst,n+1);
+    heap.free<int>(node,n);
+    heap.free<int>(lcp,n);
+    return *mdd;
+  }
+
   void
   TupleSet::TupleSetI::resize(void) {
     assert(excess == 0);
@@ -205,6 +384,22 @@ namespace Gecode {
       d->last[i] = d->tuple_data + (last[i]-tuple_data);
     }
 
+    // Supports (if already computed)
+    if (supports != NULL) {
+      unsigned int n = static_cast<unsigned int>(domsize*arity);
+      unsigned int n_data = 0;
+      for (unsigned int i = n; i--; )
+        n_data += supports[i].lst - supports[i].fst;
+      d->n_words = n_words;
+      d->support_data = heap.alloc<Support::BitSetData>(n_data);
+      heap.copy(d->support_data, support_data, n_data);
+      d->supports = heap.alloc<Supports>(n);
+      for (unsigned int i = n; i--; ) {
+        d->supports[i] = supports[i];
+        d->supports[i].s = d->support_data + (supports[i].s - support_data);
+      }
+    }
+
     return d;
   }
 
@@ -214,6 +409,9 @@ namespace Gecode {
     heap.rfree(tuple_data);
     heap.rfree(data);
     heap.rfree(last);
+    heap.rfree(supports);
+    heap.rfree(support_data);
+    delete mdd;
   }
 
 }
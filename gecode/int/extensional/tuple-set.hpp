@@ -58,9 +58,28 @@ namespace Gecode {
       max(Int::Limits::min),
       domsize(0),
       last(NULL),
-      nullpointer(NULL)
+      nullpointer(NULL),
+      n_words(0),
+      supports(NULL),
+      support_data(NULL),
+      mdd(NULL)
   {}
 
+  forceinline Support::BitSetData
+  TupleSet::TupleSetI::Supports::word(unsigned int w) const {
+    if ((w >= fst) && (w < lst))
+      return s[w-fst];
+    Support::BitSetData d; d.init(false);
+    return d;
+  }
+
+  forceinline const TupleSet::TupleSetI::Supports&
+  TupleSet::TupleSetI::support(int i, int n) const {
+    assert(supports != NULL);
+    assert((n >= min) && (n <= max));
+    return supports[i*static_cast<int>(domsize) + (n-min)];
+  }
+
 
   template<class T>
   void
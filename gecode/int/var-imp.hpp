@@ -201,10 +201,30 @@ namespace Gecode { namespace Int {
     /// Size of holes in the domain
     unsigned int holes;
 
+    /// Smallest value for which assigned variables share an implementation
+    static const int s_min = -128;
+    /// Largest value for which assigned variables share an implementation
+    static const int s_max = 255;
+    /**
+     * \brief Implementations shared by all assigned variables
+     *
+     * A variable assigned to a value \a n between \a s_min and
+     * \a s_max is never copied but refers to the shared implementation
+     * \a s_val[n-s_min] (as assigned variables cannot be modified and
+     * have no subscriptions).
+     */
+    GECODE_INT_EXPORT static IntVarImp s_val[s_max-s_min+1];
+    /// Initialize static instance (domain set up by SharedInit)
+    IntVarImp(void);
   protected:
     /// Constructor for cloning \a x
     IntVarImp(Space& home, bool share, IntVarImp& x);
   public:
+    /// Class for initializing the shared implementations
+    class SharedInit;
+    friend class SharedInit;
+    /// Return shared implementation assigned to \a n (NULL if none)
+    static IntVarImp* shared(int n);
     /// Initialize with range domain
     IntVarImp(Space& home, int min, int max);
     /// Initialize with domain specified by \a d
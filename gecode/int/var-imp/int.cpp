@@ -353,9 +353,34 @@ namespace Gecode { namespace Int {
 
   IntVarImp*
   IntVarImp::perform_copy(Space& home, bool share) {
+    if (assigned())
+      if (IntVarImp* s = shared(dom.min()))
+        return s;
     return new (home) IntVarImp(home,share,*this);
   }
 
+
+  /*
+   * Shared implementations for assigned variables
+   *
+   */
+
+  IntVarImp IntVarImp::s_val[IntVarImp::s_max-IntVarImp::s_min+1];
+
+  /// Initializes the domains of the shared variable implementations
+  class IntVarImp::SharedInit {
+  public:
+    /// Set up domains
+    SharedInit(void) {
+      for (int n=s_min; n<=s_max; n++) {
+        s_val[n-s_min].dom.min(n); s_val[n-s_min].dom.max(n);
+      }
+    }
+  };
+
+  /// Initialize shared variable implementations on startup
+  static IntVarImp::SharedInit shared_init;
+
 }}
 
 // STATISTICS: int-var
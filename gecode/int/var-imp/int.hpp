@@ -188,6 +188,15 @@ namespace Gecode { namespace Int {
    *
    */
 
+  forceinline
+  IntVarImp::IntVarImp(void)
+    : dom(0,0,NULL,NULL), holes(0) {}
+
+  forceinline IntVarImp*
+  IntVarImp::shared(int n) {
+    return ((n >= s_min) && (n <= s_max)) ? &s_val[n-s_min] : NULL;
+  }
+
   forceinline
   IntVarImp::IntVarImp(Space& home, int min, int max)
     : IntVarImpBase(home), dom(min,max,NULL,NULL), holes(0) {}
@@ -522,10 +531,9 @@ namespace Gecode { namespace Int {
         fst()->dispose(home,NULL,lst());
         fst(NULL); holes = 0;
       }
-      const int min1 = dom.min(); dom.min(min0);
-      const int max1 = dom.max(); dom.max(max0);
-      if ((min0 == min1) && (max0 == max1))
+      if ((min0 == dom.min()) && (max0 == dom.max()))
         return ME_INT_NONE;
+      dom.min(min0); dom.max(max0);
       me = (min0 == max0) ? ME_INT_VAL : ME_INT_BND;
       goto notify;
     }
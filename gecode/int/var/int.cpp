@@ -39,12 +39,14 @@
 
 namespace Gecode {
 
-  IntVar::IntVar(Space& home, int min, int max)
-    : VarImpVar<Int::IntVarImp>(new (home) Int::IntVarImp(home,min,max)) {
+  IntVar::IntVar(Space& home, int min, int max) {
     Int::Limits::check(min,"IntVar::IntVar");
     Int::Limits::check(max,"IntVar::IntVar");
     if (min > max)
       throw Int::VariableEmptyDomain("IntVar::IntVar");
+    x = (min == max) ? Int::IntVarImp::shared(min) : NULL;
+    if (x == NULL)
+      x = new (home) Int::IntVarImp(home,min,max);
   }
 
   IntVar::IntVar(Space& home, const IntSet& ds)
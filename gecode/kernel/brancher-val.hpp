@@ -53,7 +53,9 @@ namespace Gecode {
   /**
    * \brief Base class for value selection
    *
-   * Defines the brancher to be binary.
+   * Defines the brancher to be binary and to not support no-good
+   * literals. Value selection classes that do not inherit from this
+   * class must define a function ngl (see Brancher::ngl).
    */
   template<class _View, class _Val>
   class ValSelBase {
@@ -74,11 +76,38 @@ namespace Gecode {
     EmptyValSelChoice choice(Space& home);
     /// Commit to choice
     void commit(Space& home, const EmptyValSelChoice& c, unsigned a);
+    /// Return no-good literal for alternative \a a (NULL, none by default)
+    NGL* ngl(Space& home, unsigned int a, View x, Val n) const;
     /// Updating during cloning
     void update(Space& home, bool share, ValSelBase& vs);
     /// Delete value selection
     void dispose(Space& home);
   };
+
+  /**
+   * \brief No-good literal for a view \a x and a value \a n
+   *
+   * Subscribes with propagation condition \a pc to \a x.
+   */
+  template<class View, class Val, PropCond pc>
+  class ViewValNGL : public NGL {
+  protected:
+    /// The view
+    View x;
+    /// The value
+    Val n;
+  public:
+    /// Initialize for view \a x and value \a n
+    ViewValNGL(Space& home, View x, Val n);
+    /// Constructor for cloning \a ngl
+    ViewValNGL(Space& home, bool share, ViewValNGL& ngl);
+    /// Subscribe propagator \a p to view
+    virtual void subscribe(Space& home, Propagator& p);
+    /// Cancel subscription of propagator \a p to view
+    virtual void cancel(Space& home, Propagator& p);
+    /// Dispose and return size
+    virtual size_t dispose(Space& home);
+  };
   //@}
 
 
@@ -104,12 +133,45 @@ namespace Gecode {
   forceinline void
   ValSelBase<View,Val>::commit(Space&, const EmptyValSelChoice&, unsigned int) {}
   template<class View, class Val>
+  forceinline NGL*
+  ValSelBase<View,Val>::ngl(Space&, unsigned int, View, Val) const {
+    return NULL;
+  }
+  template<class View, class Val>
   forceinline void
   ValSelBase<View,Val>::update(Space&, bool, ValSelBase<View,Val>&) {}
   template<class View, class Val>
   forceinline void
   ValSelBase<View,Val>::dispose(Space&) {}
 
+  // No-good literal for view and value
+  template<class View, class Val, PropCond pc>
+  forceinline
+  ViewValNGL<View,Val,pc>::ViewValNGL(Space& home, View x0, Val n0)
+    : NGL(home), x(x0), n(n0) {}
+  template<class View, class Val, PropCond pc>
+  forceinline
+  ViewValNGL<View,Val,pc>::ViewValNGL(Space& home, bool share,
+                                      ViewValNGL& ngl)
+    : NGL(home,share,ngl), n(ngl.n) {
+    x.update(home,share,ngl.x);
+  }
+  template<class View, class Val, PropCond pc>
+  void
+  ViewValNGL<View,Val,pc>::subscribe(Space& home, Propagator& p) {
+    x.subscribe(home,p,pc,false);
+  }
+  template<class View, class Val, PropCond pc>
+  void
+  ViewValNGL<View,Val,pc>::cancel(Space& home, Propagator& p) {
+    x.cancel(home,p,pc);
+  }
+  template<class View, class Val, PropCond pc>
+  size_t
+  ViewValNGL<View,Val,pc>::dispose(Space&) {
+    return sizeof(*this);
+  }
+
 }
 
 // STATISTICS: kernel-branch
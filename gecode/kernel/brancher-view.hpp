@@ -166,6 +166,50 @@ namespace Gecode {
     ViewSelStatus select(Space& home, View x);
   };
 
+  /**
+   * \brief View selection class for view with smallest activity
+   *
+   * Activity recording for a view is started when the view is
+   * considered for selection for the first time.
+   */
+  template<class View>
+  class ViewSelActivityMin : public ViewSelBase<View> {
+  protected:
+    /// So-far smallest activity
+    double activity;
+  public:
+    /// Default constructor
+    ViewSelActivityMin(void);
+    /// Constructor for initialization
+    ViewSelActivityMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x
+    ViewSelStatus init(Space& home, View x);
+    /// Possibly select better view \a x
+    ViewSelStatus select(Space& home, View x);
+  };
+
+  /**
+   * \brief View selection class for view with largest activity
+   *
+   * Activity recording for a view is started when the view is
+   * considered for selection for the first time.
+   */
+  template<class View>
+  class ViewSelActivityMax : public ViewSelBase<View> {
+  protected:
+    /// So-far largest activity
+    double activity;
+  public:
+    /// Default constructor
+    ViewSelActivityMax(void);
+    /// Constructor for initialization
+    ViewSelActivityMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x
+    ViewSelStatus init(Space& home, View x);
+    /// Possibly select better view \a x
+    ViewSelStatus select(Space& home, View x);
+  };
+
   /**
    * \brief View selection class for random selection
    */
@@ -366,6 +410,78 @@ namespace Gecode {
   }
 
 
+  // Select variable with smallest activity
+  template<class View>
+  forceinline
+  ViewSelActivityMin<View>::ViewSelActivityMin(void) : activity(0.0) {}
+  template<class View>
+  forceinline
+  ViewSelActivityMin<View>::ViewSelActivityMin(Space& home,
+                                               const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), activity(0.0) {
+#ifndef GECODE_HAS_ACTIVITY
+    throw ActivityDisabled("ViewSelActivityMin");
+#endif
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelActivityMin<View>::init(Space& home, View x) {
+    x.activity(home);
+    activity = x.activity();
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelActivityMin<View>::select(Space& home, View x) {
+    x.activity(home);
+    double xa = x.activity();
+    if (xa < activity) {
+      activity = xa;
+      return VSS_BETTER;
+    } else if (xa > activity) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+
+
+  // Select variable with largest activity
+  template<class View>
+  forceinline
+  ViewSelActivityMax<View>::ViewSelActivityMax(void) : activity(0.0) {}
+  template<class View>
+  forceinline
+  ViewSelActivityMax<View>::ViewSelActivityMax(Space& home,
+                                               const VarBranchOptions& vbo)
+    : ViewSelBase<View>(home,vbo), activity(0.0) {
+#ifndef GECODE_HAS_ACTIVITY
+    throw ActivityDisabled("ViewSelActivityMax");
+#endif
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelActivityMax<View>::init(Space& home, View x) {
+    x.activity(home);
+    activity = x.activity();
+    return VSS_BETTER;
+  }
+  template<class View>
+  forceinline ViewSelStatus
+  ViewSelActivityMax<View>::select(Space& home, View x) {
+    x.activity(home);
+    double xa = x.activity();
+    if (xa > activity) {
+      activity = xa;
+      return VSS_BETTER;
+    } else if (xa < activity) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+
+
   // Select variable by random
   template<class View>
   forceinline
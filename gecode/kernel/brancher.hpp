@@ -126,6 +126,8 @@ namespace Gecode {
     virtual const Choice* choice(Space& home);
     /// Perform commit for choice \a c and alternative \a a
     virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a);
+    /// Create no-good literal for choice \a c and alternative \a a
+    virtual NGL* ngl(Space& home, const Choice& c, unsigned int a) const;
     /// Perform cloning
     virtual Actor* copy(Space& home, bool share);
     /// Delete brancher and return its size
@@ -389,6 +391,17 @@ namespace Gecode {
     return me_failed(valsel.tell(home,a,v,pvc.val())) ? ES_FAILED : ES_OK;
   }
 
+  template<class ViewSel, class ValSel>
+  NGL*
+  ViewValBrancher<ViewSel,ValSel>
+  ::ngl(Space& home, const Choice& c, unsigned int a) const {
+    const PosValChoice<ViewSel,ValSel>& pvc
+      = static_cast<const PosValChoice<ViewSel,ValSel>&>(c);
+    typename ValSel::View
+      v(ViewBrancher<ViewSel>::view(pvc.pos()).varimp());
+    return valsel.ngl(home,a,v,pvc.val());
+  }
+
   template<class ViewSel, class ValSel>
   forceinline size_t
   ViewValBrancher<ViewSel,ValSel>::dispose(Space& home) {
@@ -65,6 +65,26 @@ namespace Gecode {
 #endif
 
 
+  /*
+   * Branchers and no-good literals
+   *
+   */
+  NGL*
+  Brancher::ngl(Space&, const Choice&, unsigned int) const {
+    return NULL;
+  }
+
+  size_t
+  NGL::dispose(Space&) {
+    return 0;
+  }
+
+#ifdef __GNUC__
+  /// To avoid warnings from GCC
+  NGL::~NGL(void) {}
+#endif
+
+
 
   /*
    * Propagator
@@ -93,7 +113,7 @@ namespace Gecode {
 #endif
 
   Space::Space(void)
-    : sm(new SharedMemory), mm(sm), n_wmp(0) {
+    : sm(new SharedMemory), mm(sm), n_wmp(0), n_idle(0) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -104,6 +124,8 @@ namespace Gecode {
     b_status = b_commit = Brancher::cast(&bl);
     // Initialize array for forced deletion to be empty
     d_fst = d_cur = d_lst = NULL;
+    // Initialize activity buffer to be empty
+    a_fst = a_cur = a_lst = NULL;
     // Initialize space as stable but not failed
     pc.p.active = &pc.p.queue[0]-1;
     // Initialize propagator queues
@@ -111,6 +133,7 @@ namespace Gecode {
       pc.p.queue[i].init();
     pc.p.branch_id = 0;
     pc.p.n_sub = 0;
+    pc.p.n_mod = 0;
   }
 
   void
@@ -130,6 +153,18 @@ namespace Gecode {
     }
   }
 
+  void
+  Space::a_flush(void) {
+    if (a_fst == NULL) {
+      // Create new buffer
+      a_fst = alloc<PropInfo*>(a_size);
+      a_lst = a_fst+a_size;
+    } else {
+      gpi.bump(a_fst,static_cast<unsigned int>(a_cur - a_fst));
+    }
+    a_cur = a_fst;
+  }
+
   unsigned int
   Space::propagators(void) const {
     unsigned int n = 0;
@@ -150,9 +185,10 @@ namespace Gecode {
   Space::flush(void) {
     // Flush malloc cache
     sm->flush();
+    hcpool.flush();
     // Flush AFC information
     for (Propagators p(*this); p(); ++p)
-      p.propagator().pi.init();
+      gpi.init(p.propagator().pi);
   }
 
   Space::~Space(void) {
@@ -201,6 +237,8 @@ namespace Gecode {
     if (pc.p.active >= &pc.p.queue[0]) {
       Propagator* p;
       ModEventDelta med_o;
+      ExecStatus es;
+      unsigned int n_mod;
       goto unstable;
     execute:
       stat.propagate++;
@@ -208,7 +246,21 @@ namespace Gecode {
       med_o = p->u.med;
       // Clear med but leave propagator in queue
       p->u.med = 0;
-      switch (p->propagate(*this,med_o)) {
+      n_mod = pc.p.n_mod;
+      if (stat.profile == NULL) {
+        es = p->propagate(*this,med_o);
+      } else {
+        // The propagator might be disposed by propagation
+        const std::type_info& t = typeid(*p);
+        unsigned long long int c = PropagatorProfile::cycles();
+        es = p->propagate(*this,med_o);
+        stat.profile->record(t,es,PropagatorProfile::cycles()-c);
+      }
+      // Record whether the propagator has modified a variable
+      if ((n_idle > 0) && (es != __ES_SUBSUMED))
+        p->pi.modified(gpi,(es == ES_FAILED) || (n_mod != pc.p.n_mod),
+                       n_idle);
+      switch (es) {
       case ES_FAILED:
         // Count failure
         p->pi.fail(gpi);
@@ -295,6 +347,9 @@ namespace Gecode {
     // No brancher with alternatives left, space is solved
     s = SS_SOLVED;
   exit:
+    // Record buffered activity information
+    if (a_cur != a_fst)
+      a_flush();
     stat.wmp = (n_wmp > 0);
     if (n_wmp == 1) n_wmp = 0;
     return s;
@@ -378,6 +433,19 @@ namespace Gecode {
       fail();
   }
 
+  NGL*
+  Space::ngl(const Choice& c, unsigned int a) {
+    if (a >= c.alternatives())
+      throw SpaceIllegalAlternative();
+    if (failed())
+      return NULL;
+    // Find brancher (including branchers that are already done)
+    for (Branchers b(*this); b(); ++b)
+      if (c._id == b.brancher().id())
+        return b.brancher().ngl(*this,c,a);
+    return NULL;
+  }
+
 
 
   /*
@@ -395,7 +463,9 @@ namespace Gecode {
     : sm(s.sm->copy(share)), 
       mm(sm,s.mm,s.pc.p.n_sub*sizeof(Propagator**)),
       gpi(s.gpi),
-      n_wmp(s.n_wmp) {
+      n_wmp(s.n_wmp), n_idle(s.n_idle) {
+    // Activity buffer is not copied
+    a_fst = a_cur = a_lst = NULL;
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -525,6 +595,7 @@ namespace Gecode {
       c->pc.p.queue[i].init();
     // Copy propagation only data
     c->pc.p.n_sub = pc.p.n_sub;
+    c->pc.p.n_mod = 0;
     c->pc.p.branch_id = pc.p.branch_id;
     return c;
   }
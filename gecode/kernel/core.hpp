@@ -328,6 +328,17 @@ namespace Gecode {
       /// During cloning, points to the next copied variable
       VarImp<VIC>* next;
     } u;
+#ifdef GECODE_HAS_ACTIVITY
+    /**
+     * \brief Activity information (NULL if activity is not recorded)
+     *
+     * The information is allocated from the global propagator
+     * information and hence is shared among all clones of a space.
+     * Only available if Gecode has been configured with activity
+     * recording (see --enable-activity).
+     */
+    PropInfo* ai;
+#endif
 
     /// Return subscribed actor at index \a pc
     ActorLink** actor(PropCond pc);
@@ -437,6 +448,24 @@ namespace Gecode {
      * is not available during cloning.
      */
     double afc(void) const;
+    /**
+     * \brief Return activity
+     *
+     * The activity counts how often the variable implementation has
+     * been modified since recording has been started. Like the
+     * accumulated failure count, the activity is subject to the
+     * decay factor: each failure decays all activities. Returns
+     * zero if activity is not recorded.
+     */
+    double activity(void) const;
+    /**
+     * \brief Start recording activity in \a home
+     *
+     * Does nothing if the activity is already being recorded. A
+     * variable implementation counts as if it had been modified once
+     * (just now) when recording starts.
+     */
+    void activity(Space& home);
     //@}
 
     /// \name Cloning variables
@@ -942,6 +971,7 @@ namespace Gecode {
 
 
   class Brancher;
+  class NGL;
 
   /**
    * \brief %Choice for performing commit
@@ -1029,11 +1059,91 @@ namespace Gecode {
      */
     virtual ExecStatus commit(Space& home, const Choice& c, 
                               unsigned int a) = 0;
+    /**
+     * \brief Create no-good literal for choice \a c and alternative \a a
+     *
+     * The no-good literal describes what commit would tell for \a c
+     * and \a a in \a home. The default returns NULL, that is, the
+     * brancher does not support no-goods.
+     */
+    GECODE_KERNEL_EXPORT
+    virtual NGL* ngl(Space& home, const Choice& c, unsigned int a) const;
     /// Return unsigned brancher id
     unsigned int id(void) const;
     //@}
   };
 
+  /**
+   * \brief No-good literal
+   *
+   * A no-good literal describes the constraint told by a brancher
+   * for an alternative of a choice. No-good literals are used for
+   * recording no-goods from search (see Brancher::ngl), they are
+   * allocated from and owned by a space.
+   *
+   * No-good literals can be linked into a list, where a literal is
+   * either a leaf (which must be pruned) or not.
+   *
+   * \ingroup TaskActor
+   */
+  class GECODE_VTABLE_EXPORT NGL {
+  private:
+    /// Next literal in list (NULL if none)
+    NGL* _next;
+    /// Whether the literal is a leaf
+    bool _leaf;
+  public:
+    /// The status of a no-good literal
+    enum Status {
+      FAILED,   ///< The literal is failed
+      SUBSUMED, ///< The literal is subsumed
+      NONE      ///< The literal is neither failed nor subsumed
+    };
+    /// Constructor for creation
+    NGL(void);
+    /// Constructor for creation
+    NGL(Space& home);
+    /// Constructor for cloning \a ngl
+    NGL(Space& home, bool share, NGL& ngl);
+    /// Return status of literal
+    virtual NGL::Status status(const Space& home) const = 0;
+    /// Prune the literal, that is, tell its negation
+    virtual ExecStatus prune(Space& home) = 0;
+    /// Subscribe propagator \a p to the views of the literal
+    virtual void subscribe(Space& home, Propagator& p) = 0;
+    /// Cancel subscription of propagator \a p to the views of the literal
+    virtual void cancel(Space& home, Propagator& p) = 0;
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share) = 0;
+    /// Dispose and return size
+    GECODE_KERNEL_EXPORT
+    virtual size_t dispose(Space& home);
+    /// \name Linking literals
+    //@{
+    /// Return next literal
+    NGL* next(void) const;
+    /// Set next literal to \a n
+    void next(NGL* n);
+    /// Whether the literal is a leaf
+    bool leaf(void) const;
+    /// Set whether the literal is a leaf
+    void leaf(bool l);
+    //@}
+    /// \name Memory management
+    //@{
+    /// Allocate memory from space
+    static void* operator new(size_t s, Space& home);
+    /// No-op for exceptions
+    static void  operator delete(void* p, Space& home);
+    /// Not used (uses dispose instead)
+    static void  operator delete(void* p);
+    //@}
+#ifdef __GNUC__
+    /// To avoid warnings from GCC
+    GECODE_KERNEL_EXPORT virtual ~NGL(void);
+#endif
+  };
+
   /**
    * \brief Local (space-shared) object
    *
@@ -1104,6 +1214,8 @@ namespace Gecode {
     SS_BRANCH  ///< %Space must be branched (at least one brancher left)
   };
 
+  class PropagatorProfile;
+
   /**
    * \brief %Statistics for execution of status
    *
@@ -1114,6 +1226,8 @@ namespace Gecode {
     unsigned long int propagate;
     /// Whether a weakly monotonic propagator might have been executed
     bool wmp;
+    /// Profile to record propagator executions in (NULL if none)
+    PropagatorProfile* profile;
     /// Initialize
     StatusStatistics(void);
     /// Reset information
@@ -1130,6 +1244,8 @@ namespace Gecode {
    */
   class CloneStatistics {
   public:
+    /// Number of clone operations performed
+    unsigned long int clone;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1220,6 +1336,8 @@ namespace Gecode {
         unsigned int branch_id;
         /// Number of subscriptions
         unsigned int n_sub;
+        /// Number of variable modifications (for detecting idle propagators)
+        unsigned int n_mod;
       } p;
       /// Data available only during copying
       struct {
@@ -1262,6 +1380,25 @@ namespace Gecode {
     /// Resize disposal array
     GECODE_KERNEL_EXPORT void d_resize(void);
 
+    /// Number of entries in activity buffer
+    static const unsigned int a_size = 64;
+    /// First entry of activity buffer
+    PropInfo** a_fst;
+    /// Current entry of activity buffer
+    PropInfo** a_cur;
+    /// Last entry of activity buffer
+    PropInfo** a_lst;
+    /// Flush activity buffer (and allocate it, if needed)
+    GECODE_KERNEL_EXPORT void a_flush(void);
+    /**
+     * \brief Record that a variable with activity information \a ai was modified
+     *
+     * Modifications are buffered and only flushed in bulk (at
+     * the end of status or when the buffer is full), as updating
+     * activity information might require synchronization.
+     */
+    void activity(PropInfo& ai);
+
     /**
      * \brief Number of weakly monotonic propagators
      *
@@ -1270,6 +1407,8 @@ namespace Gecode {
      * it gives the number of weakly monotoning propagators minus one.
      */
     unsigned int n_wmp;
+    /// Number of idle executions after which propagators are deferred
+    unsigned int n_idle;
 
     /// Used for default argument
     GECODE_KERNEL_EXPORT static StatusStatistics unused_status;
@@ -1494,6 +1633,18 @@ namespace Gecode {
      */
     void commit(const Choice& c, unsigned int a,
                 CommitStatistics& stat=unused_commit);
+    /**
+     * \brief Create no-good literal for choice \a c and alternative \a a
+     *
+     * The choice \a c must have been created by a brancher of this
+     * space or of a space cloned from it. Returns NULL if no such
+     * brancher exists or if the brancher does not support no-good
+     * literals.
+     *
+     * \ingroup TaskSearch
+     */
+    GECODE_KERNEL_EXPORT
+    NGL* ngl(const Choice& c, unsigned int a);
 
     /**
      * \brief Notice actor property
@@ -1637,6 +1788,37 @@ namespace Gecode {
      */
     GECODE_KERNEL_EXPORT unsigned int branchers(void) const;
 
+    /**
+     * \brief %Set decay factor for accumulated failure count to \a d
+     *
+     * On each failure, the accumulated failure counts of all
+     * propagators are multiplied by \a d. The default is 1.0, that
+     * is, no decay. The decay factor is shared by all spaces
+     * cloned from this space.
+     *
+     * Throws an exception of type IllegalDecay if \a d is not
+     * in the range \f$(0,1]\f$.
+     */
+    void afc_decay(double d);
+    /// Return decay factor for accumulated failure count
+    double afc_decay(void) const;
+    /**
+     * \brief %Set limit for deferring idle propagators to \a n
+     *
+     * If \a n is greater than zero, a propagator with at least
+     * expensive linear cost that has not modified any variable during
+     * its last \a n executions is scheduled with the lowest cost
+     * (that is, after all other propagators). As soon as it modifies
+     * a variable again, it is scheduled by its cost as usual. The
+     * number of executions is shared by all clones of a propagator.
+     *
+     * The default is 0, that is, propagators are never deferred. The
+     * limit is inherited by all spaces cloned from this space.
+     */
+    void idle_limit(unsigned int n);
+    /// Return limit for deferring idle propagators
+    unsigned int idle_limit(void) const;
+
     /// \name Conversion from Space to Home
     //@{
     /// Return a home for this space with the information that \a p is being rewritten
@@ -1838,7 +2020,8 @@ namespace Gecode {
      *
      * All spaces that are obtained as non-shared clones from some same space
      * try to cache memory blocks from failed spaces. To minimize memory
-     * consumption, these blocks can be flushed.
+     * consumption, these blocks can be flushed (together with the
+     * blocks in the global pool, see HeapChunkPool).
      *
      * Also, the numbers for AFC are reset to zero.
      */
@@ -2413,6 +2596,13 @@ namespace Gecode {
     s.notice(a,p);
   }
 
+  forceinline void
+  Space::activity(PropInfo& ai) {
+    if (a_cur == a_lst)
+      a_flush();
+    *(a_cur++) = &ai;
+  }
+
   forceinline void
   Space::ignore(Actor& a, ActorProperty p) {
     if (p & AP_DISPOSE) {
@@ -2432,7 +2622,8 @@ namespace Gecode {
   }
 
   forceinline Space*
-  Space::clone(bool share, CloneStatistics&) const {
+  Space::clone(bool share, CloneStatistics& stat) const {
+    stat.clone++;
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
@@ -2519,6 +2710,28 @@ namespace Gecode {
     return pi.afc();
   }
 
+  forceinline void
+  Space::afc_decay(double d) {
+    if ((d <= 0.0) || (d > 1.0))
+      throw IllegalDecay("Space::afc_decay");
+    gpi.decay(d);
+  }
+
+  forceinline double
+  Space::afc_decay(void) const {
+    return gpi.decay();
+  }
+
+  forceinline void
+  Space::idle_limit(unsigned int n) {
+    n_idle = n;
+  }
+
+  forceinline unsigned int
+  Space::idle_limit(void) const {
+    return n_idle;
+  }
+
   forceinline ExecStatus
   Space::ES_SUBSUMED_DISPOSED(Propagator& p, size_t s) {
     p.u.size = s;
@@ -2593,6 +2806,44 @@ namespace Gecode {
     return _id;
   }
 
+  /*
+   * No-good literal
+   *
+   */
+  forceinline
+  NGL::NGL(void)
+    : _next(NULL), _leaf(false) {}
+  forceinline
+  NGL::NGL(Space&)
+    : _next(NULL), _leaf(false) {}
+  forceinline
+  NGL::NGL(Space&, bool, NGL& ngl)
+    : _next(NULL), _leaf(ngl._leaf) {}
+  forceinline NGL*
+  NGL::next(void) const {
+    return _next;
+  }
+  forceinline void
+  NGL::next(NGL* n) {
+    _next = n;
+  }
+  forceinline bool
+  NGL::leaf(void) const {
+    return _leaf;
+  }
+  forceinline void
+  NGL::leaf(bool l) {
+    _leaf = l;
+  }
+  forceinline void
+  NGL::operator delete(void*) {}
+  forceinline void
+  NGL::operator delete(void*, Space&) {}
+  forceinline void*
+  NGL::operator new(size_t s, Space& home) {
+    return home.ralloc(s);
+  }
+
   /*
    * Local objects
    *
@@ -2870,7 +3121,12 @@ namespace Gecode {
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
+    int ac = p->cost(*this,p->u.med).ac;
+    // Defer expensive propagators that have been idle
+    if ((n_idle > 0) && (ac < PropCost::AC_LINEAR_LO) &&
+        (p->pi.idle() >= n_idle))
+      ac = PropCost::AC_CRAZY_LO;
+    ActorLink* c = &pc.p.queue[ac];
     c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
@@ -2946,6 +3202,9 @@ namespace Gecode {
     for (PropCond pc=1; pc<pc_max+2; pc++)
       idx(pc) = 0;
     free_and_bits = 0;
+#ifdef GECODE_HAS_ACTIVITY
+    ai = NULL;
+#endif
   }
 
   template<class VIC>
@@ -2955,6 +3214,9 @@ namespace Gecode {
     for (PropCond pc=1; pc<pc_max+2; pc++)
       idx(pc) = 0;
     free_and_bits = 0;
+#ifdef GECODE_HAS_ACTIVITY
+    ai = NULL;
+#endif
   }
 
   template<class VIC>
@@ -2967,9 +3229,7 @@ namespace Gecode {
   template<class VIC>
   forceinline double
   VarImp<VIC>::afc(void) const {
-    if (degree() == 0)
-      return 0.0;
-    double d = degree();
+    double d = 0.0;
     // Count the afc of each propagator
     {
       ActorLink** a = const_cast<VarImp<VIC>*>(this)->actor(0);
@@ -2989,6 +3249,27 @@ namespace Gecode {
     return d;
   }
 
+  template<class VIC>
+  forceinline double
+  VarImp<VIC>::activity(void) const {
+#ifdef GECODE_HAS_ACTIVITY
+    return (ai != NULL) ? ai->afc() : 0.0;
+#else
+    return 0.0;
+#endif
+  }
+
+  template<class VIC>
+  forceinline void
+  VarImp<VIC>::activity(Space& home) {
+#ifdef GECODE_HAS_ACTIVITY
+    if (ai == NULL)
+      ai = &home.gpi.allocate();
+#else
+    (void) home;
+#endif
+  }
+
   template<class VIC>
   forceinline ModEvent
   VarImp<VIC>::modevent(const Delta& d) {
@@ -3058,6 +3339,10 @@ namespace Gecode {
     entries = x.entries;
     for (PropCond pc=1; pc<pc_max+2; pc++)
       idx(pc) = x.idx(pc);
+#ifdef GECODE_HAS_ACTIVITY
+    // Activity information is shared among all clones
+    ai = x.ai;
+#endif
 
     // Set forwarding pointer
     x.base = reinterpret_cast<ActorLink**>(Support::mark(this));
@@ -3094,6 +3379,9 @@ namespace Gecode {
   template<class VIC>
   forceinline void
   VarImp<VIC>::schedule(Space& home, PropCond pc1, PropCond pc2, ModEvent me) {
+    // Count modifications only if idle propagators are deferred
+    if (home.n_idle > 0)
+      home.pc.p.n_mod++;
     ActorLink** b = actor(pc1);
     ActorLink** p = actorNonZero(pc2+1);
     while (p-- > b)
@@ -3282,6 +3570,11 @@ namespace Gecode {
   template<class VIC>
   forceinline bool
   VarImp<VIC>::advise(Space& home, ModEvent me, Delta& d) {
+#ifdef GECODE_HAS_ACTIVITY
+    // Record activity (advise is called once for each modification)
+    if (ai != NULL)
+      home.activity(*ai);
+#endif
     /*
      * An advisor that is executed might remove itself due to subsumption.
      * As entries are removed from front to back, the advisors must
@@ -3392,7 +3685,7 @@ namespace Gecode {
     wmp = false;
   }
   forceinline
-  StatusStatistics::StatusStatistics(void) {
+  StatusStatistics::StatusStatistics(void) : profile(NULL) {
     reset();
   }
   forceinline StatusStatistics&
@@ -3408,19 +3701,22 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    clone = 0;
+  }
 
   forceinline
   CloneStatistics::CloneStatistics(void) {
     reset();
   }
   forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
   }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) { 
+  CloneStatistics::operator +=(const CloneStatistics& s) { 
+    clone += s.clone;
     return *this;
   }
 
@@ -86,6 +86,20 @@ namespace Gecode {
     TooManyBranchers(const char* l);
   };
 
+  /// %Exception: illegal decay factor
+  class GECODE_VTABLE_EXPORT IllegalDecay : public Exception {
+  public:
+    /// Initialize with location \a l
+    IllegalDecay(const char* l);
+  };
+
+  /// %Exception: activity is not recorded (configured without --enable-activity)
+  class GECODE_VTABLE_EXPORT ActivityDisabled : public Exception {
+  public:
+    /// Initialize with location \a l
+    ActivityDisabled(const char* l);
+  };
+
   //@}
 
   /*
@@ -119,6 +133,14 @@ namespace Gecode {
   TooManyBranchers::TooManyBranchers(const char* l)
     : Exception(l,"Too many branchers created") {}
 
+  inline
+  IllegalDecay::IllegalDecay(const char* l)
+    : Exception(l,"Illegal decay factor") {}
+
+  inline
+  ActivityDisabled::ActivityDisabled(const char* l)
+    : Exception(l,"Activity recording is disabled") {}
+
 }
 
 // STATISTICS: kernel-other
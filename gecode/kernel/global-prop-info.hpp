@@ -41,21 +41,47 @@ namespace Gecode {
 
   /// Class for propagator information
   class PropInfo {
+    friend class GlobalPropInfo;
   private:
     /// Accumulated failure count
     double _afc;
+    /// Number of consecutive executions without modifying a variable
+    volatile int _idle;
   public:
     /// Initialize
     PropInfo(void);
-    /// Initialize
-    void init(void);
+    /// Initialize with accumulated failure count \a a
+    void init(double a);
     /// Return accumulated failure count
     double afc(void) const;
+    /// Return number of consecutive executions without modification
+    unsigned int idle(void) const;
+    /**
+     * \brief Record an execution that did (\a m is true) or did not modify
+     *
+     * Consecutive executions without modification are counted up to
+     * \a n. As the information is shared by all clones of a propagator,
+     * access is synchronized through \a gpi.
+     */
+    void modified(GlobalPropInfo& gpi, bool m, unsigned int n);
+    /// Scale accumulated failure count by \a s
+    void scale(double s);
     /// Increment failure count
     void fail(GlobalPropInfo& gpi);
   };
 
-  /// Globally shared object for propagator information
+  /**
+   * \brief Globally shared object for propagator information
+   *
+   * The accumulated failure count (AFC) of a propagator can be
+   * subject to a decay factor \f$d\f$ with \f$0<d\leq 1\f$: each time
+   * a propagator fails, the AFC of all propagators is multiplied by
+   * \f$d\f$. Instead of updating all propagators, the decay is
+   * implemented by a global increment that is multiplied by
+   * \f$1/d\f$ on each failure. Only if the increment exceeds a limit,
+   * all failure counts (and the increment) are rescaled.
+   *
+   */
   class GlobalPropInfo {
     friend class PropInfo;
   private:
@@ -64,22 +90,53 @@ namespace Gecode {
     public:
       /// Next block
       Block* next;
+      /// Number of entries
+      unsigned int n;
       /// Start of information entries
       PropInfo pi[1];
       /// Allocate block with \a n entries and previous block \a p
       static Block* allocate(unsigned int n, Block* p=NULL);
+      /// Scale all entries by \a s
+      void scale(double s);
     };
     /// Initial smallest number of entries per block
     static const unsigned int size_min = 32;
     /// Largest possible number of entries per block
     static const unsigned int size_max = 32 * 1024;
+    class Object;
+    /// Information shared by all objects
+    class Shared {
+    public:
+      /// Mutex to synchronize globally shared access
+      Support::Mutex m;
+      /// Decay factor
+      double d;
+      /// Inverse of decay factor
+      double invd;
+      /// Current increment for a failure
+      double inc;
+      /// All objects sharing this information
+      Object* all;
+      /// Constructor
+      Shared(void);
+      /// Rescale all failure counts and the increment
+      void rescale(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
     /// The actual object to store the required information
     class Object {
     public:
-      /// Mutex to synchronize globally shared access
-      Support::Mutex* mutex;
+      /// Shared information
+      Shared* shared;
       /// Link to previous object (NULL if none)
       Object* parent;
+      /// Previous object in list of all objects
+      Object* prev;
+      /// Next object in list of all objects
+      Object* next;
       /// How many spaces or objects use this object
       unsigned int use_cnt;
       /// Size of current block
@@ -88,8 +145,8 @@ namespace Gecode {
       unsigned int free;
       /// Currently used block
       Block* cur;
-      /// Constructor
-      Object(Support::Mutex* m, Object* p=NULL);
+      /// Constructor (must be called with mutex of \a s acquired)
+      Object(Shared* s, Object* p=NULL);
       /// Allocate memory from heap
       static void* operator new(size_t s);
       /// Free memory allocated from heap
@@ -114,6 +171,20 @@ namespace Gecode {
     ~GlobalPropInfo(void);
     /// Allocate new propagator info
     PropInfo& allocate(void);
+    /// Initialize propagator info \a pi
+    void init(PropInfo& pi);
+    /**
+     * \brief Increment \a n entries \a pi by the current increment
+     *
+     * Used for recording the activity of variables: the increment
+     * grows with each failure, hence older activity decays with
+     * the same factor as the accumulated failure count.
+     */
+    void bump(PropInfo** pi, unsigned int n);
+    /// Set decay factor to \a d
+    void decay(double d);
+    /// Return decay factor
+    double decay(void) const;
   };
 
 
@@ -123,15 +194,23 @@ namespace Gecode {
    */
   forceinline
   PropInfo::PropInfo(void)
-    : _afc(0.0) {}
+    : _afc(0.0), _idle(0) {}
   forceinline void
-  PropInfo::init(void) {
-    _afc=0.0;
+  PropInfo::init(double a) {
+    _afc=a; _idle=0;
   }
   forceinline double
   PropInfo::afc(void) const {
     return _afc;
   }
+  forceinline unsigned int
+  PropInfo::idle(void) const {
+    return static_cast<unsigned int>(_idle);
+  }
+  forceinline void
+  PropInfo::scale(double s) {
+    _afc *= s;
+  }
 
 
   /*
@@ -139,6 +218,20 @@ namespace Gecode {
    *
    */
 
+  forceinline void*
+  GlobalPropInfo::Shared::operator new(size_t s) {
+    return Gecode::heap.ralloc(s);
+  }
+
+  forceinline void
+  GlobalPropInfo::Shared::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+
+  forceinline
+  GlobalPropInfo::Shared::Shared(void)
+    : d(1.0), invd(1.0), inc(1.0), all(NULL) {}
+
   forceinline void*
   GlobalPropInfo::Object::operator new(size_t s) {
     return Gecode::heap.ralloc(s);
@@ -154,13 +247,37 @@ namespace Gecode {
     Block* b = static_cast<Block*>(heap.ralloc(sizeof(Block)+
                                                (n-1)*sizeof(PropInfo)));
     b->next = p;
+    b->n = n;
+    // Entries must be initialized as they might be rescaled
+    for (unsigned int i=n; i--; )
+      b->pi[i].init(0.0);
     return b;
   }
 
+  forceinline void
+  GlobalPropInfo::Block::scale(double s) {
+    for (unsigned int i=n; i--; )
+      pi[i].scale(s);
+  }
+
+  forceinline void
+  GlobalPropInfo::Shared::rescale(void) {
+    double s = 1.0 / inc;
+    for (Object* o = all; o != NULL; o = o->next)
+      for (Block* b = o->cur; b != NULL; b = b->next)
+        b->scale(s);
+    inc = 1.0;
+  }
+
   forceinline
-  GlobalPropInfo::Object::Object(Support::Mutex* m, Object* p)
-    : mutex(m), parent(p), use_cnt(1), size(size_min), free(size_min),
-      cur(Block::allocate(size)) {}
+  GlobalPropInfo::Object::Object(Shared* s, Object* p)
+    : shared(s), parent(p), prev(NULL), next(s->all),
+      use_cnt(1), size(size_min), free(size_min),
+      cur(Block::allocate(size)) {
+    if (next != NULL)
+      next->prev = this;
+    s->all = this;
+  }
 
   forceinline GlobalPropInfo::Object*
   GlobalPropInfo::object(void) const {
@@ -183,22 +300,22 @@ namespace Gecode {
   forceinline
   GlobalPropInfo::GlobalPropInfo(void) {
     // No synchronization needed as single thread is creating this object
-    local(new Object(new Support::Mutex));
+    local(new Object(new Shared));
   }
 
   forceinline
   GlobalPropInfo::GlobalPropInfo(const GlobalPropInfo& gpi) {
     global(gpi.mo);
     Object* o = object();
-    o->mutex->acquire();
+    o->shared->m.acquire();
     o->use_cnt++;
-    o->mutex->release();
+    o->shared->m.release();
   }
 
   forceinline
   GlobalPropInfo::~GlobalPropInfo(void) {
-    Support::Mutex* m = object()->mutex;
-    m->acquire();
+    Shared* s = object()->shared;
+    s->m.acquire();
     Object* c = object();
     while ((c != NULL) && (--c->use_cnt == 0)) {
       // Delete all blocks for c
@@ -207,22 +324,62 @@ namespace Gecode {
         Block* d = b; b=b->next;
         heap.rfree(d);
       }
+      // Remove c from list of all objects
+      if (c->prev != NULL)
+        c->prev->next = c->next;
+      else
+        s->all = c->next;
+      if (c->next != NULL)
+        c->next->prev = c->prev;
       // Delete object
       Object* d = c; c = c->parent;
       delete d; 
     }
-    m->release();
-    // All objects are deleted, so also delete mutex
+    s->m.release();
+    // All objects are deleted, so also delete shared information
     if (c == NULL)
-      delete m;
+      delete s;
   }
 
   forceinline void
   PropInfo::fail(GlobalPropInfo& gpi) {
-    Support::Mutex& m = *gpi.object()->mutex;
-    m.acquire();
-    _afc++;
-    m.release();
+    GlobalPropInfo::Shared& s = *gpi.object()->shared;
+#ifdef GECODE_HAS_ATOMICS
+    if (s.d == 1.0) {
+      // No need to lock, the increment is atomic
+      (void) Support::atomic_add(_afc,1.0);
+      return;
+    }
+#endif
+    s.m.acquire();
+    _afc += s.inc;
+    s.inc *= s.invd;
+    // Rescale to avoid overflow
+    if (s.inc > 1e100)
+      s.rescale();
+    s.m.release();
+  }
+
+  forceinline void
+  PropInfo::modified(GlobalPropInfo& gpi, bool m, unsigned int n) {
+    // Only write if the count changes
+    if (m ? (_idle == 0) : (static_cast<unsigned int>(_idle) >= n))
+      return;
+#ifdef GECODE_HAS_ATOMICS
+    (void) gpi;
+    // A lost concurrent update only delays (un)deferring
+    if (m) {
+      int i = _idle;
+      (void) Support::atomic_cas(_idle,i,0);
+    } else {
+      (void) Support::atomic_add(_idle,1);
+    }
+#else
+    GlobalPropInfo::Shared& s = *gpi.object()->shared;
+    s.m.acquire();
+    _idle = m ? 0 : _idle+1;
+    s.m.release();
+#endif
   }
 
   forceinline PropInfo&
@@ -230,11 +387,16 @@ namespace Gecode {
     /*
      * If there is no local object, create one.
      *
-     * There is no synchronization needed as only ONE space has access
-     * to the marked pointer AND the local object.
+     * Only creating the object requires synchronization as it must
+     * be entered into the list of all objects. Otherwise, only ONE
+     * space has access to the marked pointer AND the local object.
      */
-    if (!local())
-      local(new Object(object()->mutex,object()));
+    if (!local()) {
+      Shared* s = object()->shared;
+      s->m.acquire();
+      local(new Object(s,object()));
+      s->m.release();
+    }
 
     assert(local());
 
@@ -243,14 +405,54 @@ namespace Gecode {
     if (o->free == 0) {
       if (2*o->size <= size_max)
         o->size *= 2;
+      Shared* s = o->shared;
+      s->m.acquire();
       o->free = o->size;
       o->cur  = Block::allocate(o->size,o->cur);
+      s->m.release();
+    }
+
+    PropInfo& pi = o->cur->pi[--o->free];
+    init(pi);
+
+    return pi;
+  }
+
+  forceinline void
+  GlobalPropInfo::init(PropInfo& pi) {
+    // A new propagator counts as if it had failed once (just now)
+    pi.init(object()->shared->inc);
+  }
+
+  forceinline void
+  GlobalPropInfo::bump(PropInfo** pi, unsigned int n) {
+    Shared& s = *object()->shared;
+#ifdef GECODE_HAS_ATOMICS
+    if (s.d == 1.0) {
+      // No need to lock, the increment is atomic
+      for (unsigned int i=n; i--; )
+        (void) Support::atomic_add(pi[i]->_afc,1.0);
+      return;
     }
+#endif
+    s.m.acquire();
+    for (unsigned int i=n; i--; )
+      pi[i]->_afc += s.inc;
+    s.m.release();
+  }
 
-    PropInfo* pi = &o->cur->pi[--o->free];
-    pi->init();
+  forceinline void
+  GlobalPropInfo::decay(double d) {
+    Shared* s = object()->shared;
+    s->m.acquire();
+    s->d = d;
+    s->invd = 1.0 / d;
+    s->m.release();
+  }
 
-    return *pi;
+  forceinline double
+  GlobalPropInfo::decay(void) const {
+    return object()->shared->d;
   }
 
 }
@@ -46,6 +46,28 @@ namespace Gecode {
      * \brief How many heap chunks should be cached at most
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief How many heap chunks should be kept in the global pool at most
+     *
+     * Heap chunks that do not fit into the cache of a shared memory
+     * object are handed to a global pool shared by all threads (where
+     * other threads can pick them up).
+     *
+     * The limit is fixed rather than derived from the sizes of the
+     * spaces being cloned: the pool only keeps chunks that would
+     * otherwise be freed, so a bound that covers the caches of a
+     * few dozen threads suffices and keeps the memory held by the
+     * pool predictable.
+     */
+    const unsigned int n_hc_pool = 16*16;
+    /**
+     * \brief How many heap chunks are taken at once from the global pool
+     *
+     * Taking a small batch keeps the time the pool is locked short
+     * while still refilling the cache of a shared memory object for
+     * several clones.
+     */
+    const unsigned int n_hc_batch = 4;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
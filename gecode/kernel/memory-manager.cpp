@@ -39,6 +39,89 @@
 
 namespace Gecode {
 
+  /*
+   * Global heap chunk pool
+   *
+   */
+
+  HeapChunkPool hcpool;
+
+  HeapChunk*
+  HeapChunkPool::get(size_t l) {
+    if (!m.tryacquire())
+      return NULL;
+    // Chunks to be returned
+    HeapChunk* f = NULL;
+    unsigned int n = 0;
+    // Chunks that are too small remain in the pool
+    HeapChunk* k_fst = NULL;
+    HeapChunk* k_lst = NULL;
+    while ((hc != NULL) && (n < MemoryConfig::n_hc_batch)) {
+      HeapChunk* c = hc; hc = static_cast<HeapChunk*>(c->next);
+      if (c->size >= l) {
+        c->next = f; f = c; n++;
+      } else {
+        c->next = NULL;
+        if (k_lst == NULL)
+          k_fst = c;
+        else
+          k_lst->next = c;
+        k_lst = c;
+      }
+    }
+    if (k_lst != NULL) {
+      k_lst->next = hc; hc = k_fst;
+    }
+    n_hc -= n;
+    m.release();
+    return f;
+  }
+
+  HeapChunk*
+  HeapChunkPool::put(HeapChunk* l, bool wait) {
+    if (wait)
+      m.acquire();
+    else if (!m.tryacquire())
+      return l;
+    while ((l != NULL) && (n_hc < MemoryConfig::n_hc_pool)) {
+      HeapChunk* c = l; l = static_cast<HeapChunk*>(l->next);
+      c->next = hc; hc = c; n_hc++;
+    }
+    m.release();
+    return l;
+  }
+
+  void
+  HeapChunkPool::statistics(const HeapChunkStatistics& s0) {
+    m.acquire();
+    s += s0;
+    m.release();
+  }
+
+  HeapChunkStatistics
+  HeapChunkPool::statistics(void) {
+    m.acquire();
+    HeapChunkStatistics s0 = s;
+    m.release();
+    return s0;
+  }
+
+  void
+  HeapChunkPool::flush(void) {
+    m.acquire();
+    while (hc != NULL) {
+      HeapChunk* c = hc;
+      hc = static_cast<HeapChunk*>(c->next);
+      heap.rfree(c);
+    }
+    n_hc = 0;
+    m.release();
+  }
+
+  HeapChunkPool::~HeapChunkPool(void) {
+    flush();
+  }
+
   void
   MemoryManager::alloc_refill(SharedMemory* sm, size_t sz) {
     // Try to reuse the not used memory
@@ -57,6 +57,91 @@ namespace Gecode {
     double area[1];
   };
 
+  /**
+   * \brief Statistics on how requests for heap chunks have been served
+   * \ingroup FuncMemSpace
+   */
+  class HeapChunkStatistics {
+  public:
+    /// Number of requests served from the cache of a shared memory object
+    unsigned long int hit;
+    /// Number of requests served from the global heap chunk pool
+    unsigned long int pool;
+    /// Number of requests for which memory was allocated from the heap
+    unsigned long int miss;
+    /// Initialize
+    HeapChunkStatistics(void);
+    /// Reset information
+    void reset(void);
+    /// Add statistics \a s
+    HeapChunkStatistics& operator +=(const HeapChunkStatistics& s);
+  };
+
+  /**
+   * \brief Global pool of heap chunks shared by all threads
+   *
+   * Spaces that are cloned with sharing (which are always used by a
+   * single thread) cache heap chunks in their shared memory object
+   * without any synchronization. Chunks that do not fit into that
+   * cache, and all chunks cached by a shared memory object when it is
+   * deleted, are kept by the global pool. Shared memory objects that
+   * run out of cached chunks take chunks from the pool before
+   * allocating from the heap.
+   *
+   * The pool never blocks during search: if it is used by another
+   * thread, chunks are allocated from or returned to the heap directly.
+   * The pool is protected by a mutex rather than being a lock-free
+   * stack based on compare-and-swap (see Support::atomic_cas): popping
+   * from such a stack suffers from the ABA problem if another thread
+   * takes a chunk and returns it in between.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class HeapChunkPool {
+  private:
+    /// Mutex for synchronizing access
+    Support::Mutex m;
+    /// Number of chunks in the pool
+    unsigned int n_hc;
+    /// The chunks in the pool
+    HeapChunk* hc;
+    /// Statistics of deleted shared memory objects
+    HeapChunkStatistics s;
+  public:
+    /// Initialize
+    HeapChunkPool(void);
+    /**
+     * \brief Return list of chunks of size at least \a l
+     *
+     * Returns at most MemoryConfig::n_hc_batch chunks, returns NULL
+     * if there are none or if the pool is currently busy.
+     */
+    GECODE_KERNEL_EXPORT HeapChunk* get(size_t l);
+    /**
+     * \brief Put the chunks of the list \a l into the pool
+     *
+     * Returns the list of chunks that did not fit into the pool. If
+     * \a wait is false and the pool is busy, \a l is returned.
+     */
+    GECODE_KERNEL_EXPORT HeapChunk* put(HeapChunk* l, bool wait);
+    /// Add statistics \a s of a deleted shared memory object
+    GECODE_KERNEL_EXPORT void statistics(const HeapChunkStatistics& s);
+    /**
+     * \brief Return statistics
+     *
+     * The statistics include the requests of all shared memory
+     * objects that have been deleted so far.
+     */
+    GECODE_KERNEL_EXPORT HeapChunkStatistics statistics(void);
+    /// Free all chunks in the pool
+    GECODE_KERNEL_EXPORT void flush(void);
+    /// Destructor
+    GECODE_KERNEL_EXPORT ~HeapChunkPool(void);
+  };
+
+  /// The global heap chunk pool
+  extern GECODE_KERNEL_EXPORT HeapChunkPool hcpool;
+
   class Region;
 
   /// Shared object for several memory areas
@@ -78,6 +163,8 @@ namespace Gecode {
       unsigned int n_hc;
       /// A list of cached heap chunks
       HeapChunk* hc;
+      /// Statistics for requests of heap chunks
+      HeapChunkStatistics stat;
     } heap;
   public:
     /// Initialize
@@ -192,6 +279,35 @@ namespace Gecode {
   };
 
 
+  /*
+   * Heap chunk statistics
+   *
+   */
+
+  forceinline void
+  HeapChunkStatistics::reset(void) {
+    hit = pool = miss = 0;
+  }
+  forceinline
+  HeapChunkStatistics::HeapChunkStatistics(void) {
+    reset();
+  }
+  forceinline HeapChunkStatistics&
+  HeapChunkStatistics::operator +=(const HeapChunkStatistics& s) {
+    hit += s.hit; pool += s.pool; miss += s.miss;
+    return *this;
+  }
+
+  /*
+   * Global heap chunk pool
+   *
+   */
+
+  forceinline
+  HeapChunkPool::HeapChunkPool(void)
+    : n_hc(0), hc(NULL) {}
+
+
   /*
    * Shared memory area
    *
@@ -223,6 +339,9 @@ namespace Gecode {
   }
   forceinline
   SharedMemory::~SharedMemory(void) {
+    hcpool.statistics(heap.stat);
+    // Keep cached chunks for other shared memory objects
+    heap.hc = hcpool.put(heap.hc,true);
     flush();
   }
   forceinline SharedMemory*
@@ -257,10 +376,22 @@ namespace Gecode {
     }
     if (heap.hc == NULL) {
       assert(heap.n_hc == 0);
-      HeapChunk* hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
+      // Try to get chunks from the global pool
+      HeapChunk* hc = hcpool.get(l);
+      if (hc == NULL) {
+        heap.stat.miss++;
+        hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+        hc->size = s;
+        return hc;
+      }
+      heap.stat.pool++;
+      // Cache all but the first chunk
+      heap.hc = static_cast<HeapChunk*>(hc->next);
+      for (MemoryChunk* c = heap.hc; c != NULL; c = c->next)
+        heap.n_hc++;
       return hc;
     } else {
+      heap.stat.hit++;
       heap.n_hc--;
       HeapChunk* hc = heap.hc;
       heap.hc = static_cast<HeapChunk*>(hc->next);
@@ -270,7 +401,9 @@ namespace Gecode {
   forceinline void
   SharedMemory::heap_free(HeapChunk* hc) {
     if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
+      hc->next = NULL;
+      if (hcpool.put(hc,false) != NULL)
+        Gecode::heap.rfree(hc);
     } else {
       heap.n_hc++;
       hc->next = heap.hc; heap.hc = hc;
@@ -0,0 +1,224 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include <gecode/kernel.hh>
+
+#include <algorithm>
+#include <iomanip>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace Gecode {
+
+  std::string
+  PropagatorProfile::Entry::name(void) const {
+#ifdef __GNUC__
+    int status;
+    char* d = abi::__cxa_demangle(type->name(), NULL, NULL, &status);
+    if (d != NULL) {
+      std::string s(d);
+      free(d);
+      return s;
+    }
+#endif
+    return type->name();
+  }
+
+  PropagatorProfile::PropagatorProfile(void)
+    : n(0), size(0), e(NULL), h(NULL), h_size(0), h_used(0),
+      parent(NULL), fst(NULL), next(NULL) {}
+
+  PropagatorProfile::PropagatorProfile(PropagatorProfile* p)
+    : n(0), size(0), e(NULL), h(NULL), h_size(0), h_used(0),
+      parent(p), fst(NULL), next(NULL) {
+    if (parent != NULL) {
+      Support::Lock l(parent->m);
+      next = parent->fst; parent->fst = this;
+    }
+  }
+
+  PropagatorProfile::Entry&
+  PropagatorProfile::add(const std::type_info& t) {
+    /*
+     * A class might have several class information objects (for
+     * example, when used from different shared libraries), hence
+     * entries are compared by class.
+     */
+    int k = -1;
+    for (int i=n; i--; )
+      if (*e[i].type == t) {
+        k = i; break;
+      }
+    if (k < 0) {
+      if (n == size) {
+        int s = std::max(2*size,16);
+        e = heap.realloc<Entry>(e,size,s);
+        size = s;
+      }
+      k = n++;
+      Entry& x = e[k];
+      x.type = &t;
+      x.propagate = x.fix = x.nofix = x.failed = x.subsumed = x.partial = 0;
+      x.cycles = 0;
+    }
+    // Keep hash table at most half full
+    if (2*(h_used+1) > h_size) {
+      Slot* o = h;
+      unsigned int o_size = h_size;
+      h_size = std::max(2*h_size,32U);
+      h = heap.alloc<Slot>(h_size);
+      for (unsigned int i=h_size; i--; )
+        h[i].type = NULL;
+      for (unsigned int i=o_size; i--; )
+        if (o[i].type != NULL) {
+          unsigned int j = hash(*o[i].type);
+          while (h[j].type != NULL)
+            j = (j+1) & (h_size-1);
+          h[j] = o[i];
+        }
+      heap.free<Slot>(o,o_size);
+    }
+    unsigned int j = hash(t);
+    while (h[j].type != NULL)
+      j = (j+1) & (h_size-1);
+    h[j].type = &t; h[j].i = k;
+    h_used++;
+    return e[k];
+  }
+
+  void
+  PropagatorProfile::collect(PropagatorProfile& p) {
+    for (int i=0; i<p.n; i++) {
+      Entry& x = p.e[i];
+      if (x.propagate == 0)
+        continue;
+      Entry& y = entry(*x.type);
+      y.propagate += x.propagate; y.fix += x.fix; y.nofix += x.nofix;
+      y.failed += x.failed; y.subsumed += x.subsumed;
+      y.partial += x.partial; y.cycles += x.cycles;
+      x.propagate = x.fix = x.nofix = x.failed = x.subsumed = x.partial = 0;
+      x.cycles = 0;
+    }
+  }
+
+  void
+  PropagatorProfile::merge(void) {
+    Support::Lock l(m);
+    for (PropagatorProfile* p = fst; p != NULL; p = p->next)
+      collect(*p);
+  }
+
+  /// Order entries by decreasing number of cycles
+  class ProfileEntryLess {
+  public:
+    bool operator ()(const PropagatorProfile::Entry& x,
+                     const PropagatorProfile::Entry& y) const {
+      return x.cycles > y.cycles;
+    }
+  };
+
+  void
+  PropagatorProfile::sort(void) {
+    ProfileEntryLess el;
+    std::stable_sort(e, e+n, el);
+    // Entries have moved
+    for (unsigned int i=h_size; i--; )
+      h[i].type = NULL;
+    h_used = 0;
+  }
+
+  void
+  PropagatorProfile::reset(void) {
+    n = 0;
+    for (unsigned int i=h_size; i--; )
+      h[i].type = NULL;
+    h_used = 0;
+  }
+
+  void
+  PropagatorProfile::print(std::ostream& os) {
+    merge();
+    sort();
+    unsigned long long int c = 0;
+    for (int i=n; i--; )
+      c += e[i].cycles;
+    std::ios::fmtflags f = os.flags();
+    std::streamsize p = os.precision();
+    char fc = os.fill(' ');
+    os << std::setw(12) << "cycles" << std::setw(8) << "%"
+       << std::setw(12) << "propagate" << std::setw(10) << "fix"
+       << std::setw(10) << "nofix" << std::setw(10) << "failed"
+       << std::setw(10) << "subsumed" << std::setw(10) << "partial"
+       << "  propagator" << std::endl;
+    for (int i=0; i<n; i++)
+      os << std::setw(12) << e[i].cycles
+         << std::setw(8) << std::fixed << std::setprecision(2)
+         << ((c > 0) ? (100.0 * e[i].cycles) / c : 0.0)
+         << std::setw(12) << e[i].propagate
+         << std::setw(10) << e[i].fix
+         << std::setw(10) << e[i].nofix
+         << std::setw(10) << e[i].failed
+         << std::setw(10) << e[i].subsumed
+         << std::setw(10) << e[i].partial
+         << "  " << e[i].name() << std::endl;
+    os.flags(f); os.precision(p); os.fill(fc);
+  }
+
+  PropagatorProfile::~PropagatorProfile(void) {
+    if (parent != NULL) {
+      Support::Lock l(parent->m);
+      parent->collect(*this);
+      PropagatorProfile** p = &parent->fst;
+      while (*p != this)
+        p = &(*p)->next;
+      *p = next;
+    }
+    {
+      // Remaining per-thread profiles are not merged any longer
+      Support::Lock l(m);
+      for (PropagatorProfile* p = fst; p != NULL; p = p->next)
+        p->parent = NULL;
+    }
+    heap.free<Entry>(e,size);
+    heap.free<Slot>(h,h_size);
+  }
+
+}
+
+// STATISTICS: kernel-prop
@@ -0,0 +1,226 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include <typeinfo>
+#include <string>
+#include <iostream>
+#include <ctime>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Gecode {
+
+  /**
+   * \brief Profile of propagator executions
+   *
+   * A profile records for each propagator class how often propagators
+   * of that class have been executed, how often the execution resulted
+   * in a fixpoint, no fixpoint, failure, subsumption, or partial
+   * rescheduling, and how many processor cycles (as measured by the
+   * processor's time-stamp counter, if available) have been spent.
+   *
+   * Profiling is enabled by passing a profile as part of the
+   * statistics to Space::status (or as option to a search engine).
+   * Recording is not synchronized: a profile must only be used by
+   * a single thread. Search engines hence record into a profile per
+   * worker, created with the profile passed as option as its parent.
+   * The entries of all such per-thread profiles are added to the
+   * parent by merge (also done by print) and when they are deleted.
+   *
+   * \ingroup TaskActor
+   */
+  class GECODE_KERNEL_EXPORT PropagatorProfile {
+  public:
+    /// Information for a single propagator class
+    class Entry {
+    public:
+      /// The propagator class
+      const std::type_info* type;
+      /// Number of executions
+      unsigned long int propagate;
+      /// Number of executions that resulted in a fixpoint
+      unsigned long int fix;
+      /// Number of executions that did not result in a fixpoint
+      unsigned long int nofix;
+      /// Number of executions that resulted in failure
+      unsigned long int failed;
+      /// Number of executions that resulted in subsumption
+      unsigned long int subsumed;
+      /// Number of executions that resulted in partial rescheduling
+      unsigned long int partial;
+      /// Number of cycles spent
+      unsigned long long int cycles;
+      /// Return (demangled, if possible) name of propagator class
+      std::string name(void) const;
+    };
+  private:
+    /// Slot of hash table mapping propagator classes to entries
+    class Slot {
+    public:
+      /// The propagator class (NULL if slot is empty)
+      const std::type_info* type;
+      /// Index of the entry for the class
+      int i;
+    };
+    /// Number of entries
+    int n;
+    /// Size of entry array
+    int size;
+    /// The entries
+    Entry* e;
+    /// Hash table indexed by the address of the class information
+    Slot* h;
+    /// Size of hash table (zero or a power of two)
+    unsigned int h_size;
+    /// Number of used slots in hash table
+    unsigned int h_used;
+    /// Mutex for synchronizing access to per-thread profiles
+    Support::Mutex m;
+    /// Parent profile (NULL if none)
+    PropagatorProfile* parent;
+    /// First per-thread profile with this profile as parent
+    PropagatorProfile* fst;
+    /// Next per-thread profile with the same parent
+    PropagatorProfile* next;
+    /// Return hash table slot position for class \a t
+    unsigned int hash(const std::type_info& t) const;
+    /// Return entry for propagator class \a t
+    Entry& entry(const std::type_info& t);
+    /// Return entry for propagator class \a t not found in hash table
+    Entry& add(const std::type_info& t);
+    /// Add entries of profile \a p and reset them in \a p
+    void collect(PropagatorProfile& p);
+  public:
+    /// Initialize empty profile
+    PropagatorProfile(void);
+    /**
+     * \brief Initialize empty per-thread profile with parent \a p
+     *
+     * The entries are added to \a p when \a p is merged and when
+     * this profile is deleted.
+     */
+    explicit PropagatorProfile(PropagatorProfile* p);
+    /// Return current value of cycle counter
+    static unsigned long long int cycles(void);
+    /// Record execution of propagator class \a t with status \a es and \a c cycles
+    void record(const std::type_info& t, ExecStatus es,
+                unsigned long long int c);
+    /**
+     * \brief Add the entries of all per-thread profiles
+     *
+     * Must not be called while a per-thread profile is recording
+     * (that is, while a search engine is searching).
+     */
+    void merge(void);
+    /// Return number of recorded propagator classes
+    int entries(void) const;
+    /// Return information for \a i-th recorded propagator class
+    const Entry& operator [](int i) const;
+    /// Sort entries by number of cycles (most expensive first)
+    void sort(void);
+    /// Reset profile
+    void reset(void);
+    /// Merge and print profile to \a os
+    void print(std::ostream& os);
+    /// Destructor
+    ~PropagatorProfile(void);
+  private:
+    /// Copy constructor (disabled)
+    PropagatorProfile(const PropagatorProfile&);
+    /// Assignment operator (disabled)
+    PropagatorProfile& operator =(const PropagatorProfile&);
+  };
+
+  forceinline unsigned long long int
+  PropagatorProfile::cycles(void) {
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    unsigned int lo, hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return (static_cast<unsigned long long int>(hi) << 32) | lo;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return __rdtsc();
+#else
+    return static_cast<unsigned long long int>(clock());
+#endif
+  }
+
+  forceinline unsigned int
+  PropagatorProfile::hash(const std::type_info& t) const {
+    return static_cast<unsigned int>(reinterpret_cast<size_t>(&t) >> 4)
+      & (h_size-1);
+  }
+
+  forceinline PropagatorProfile::Entry&
+  PropagatorProfile::entry(const std::type_info& t) {
+    if (h_size > 0)
+      for (unsigned int i=hash(t); h[i].type != NULL; i=(i+1) & (h_size-1))
+        if (h[i].type == &t)
+          return e[h[i].i];
+    return add(t);
+  }
+
+  forceinline void
+  PropagatorProfile::record(const std::type_info& t, ExecStatus es,
+                            unsigned long long int c) {
+    Entry& x = entry(t);
+    x.propagate++;
+    x.cycles += c;
+    switch (es) {
+    case ES_FAILED:     x.failed++;   break;
+    case ES_NOFIX:      x.nofix++;    break;
+    case ES_FIX:        x.fix++;      break;
+    case __ES_SUBSUMED: x.subsumed++; break;
+    case __ES_PARTIAL:  x.partial++;  break;
+    default: GECODE_NEVER;
+    }
+  }
+
+  forceinline int
+  PropagatorProfile::entries(void) const {
+    return n;
+  }
+
+  forceinline const PropagatorProfile::Entry&
+  PropagatorProfile::operator [](int i) const {
+    assert((i >= 0) && (i < n));
+    return e[i];
+  }
+
+}
+
+// STATISTICS: kernel-prop
@@ -67,6 +67,8 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Return activity (zero if activity is not recorded)
+    double activity(void) const;
     //@}
 
     /// \name Domain tests
@@ -119,6 +121,11 @@ namespace Gecode {
     return x->afc();
   }
   template<class VarImp>
+  forceinline double
+  VarImpVar<VarImp>::activity(void) const {
+    return x->activity();
+  }
+  template<class VarImp>
   forceinline bool
   VarImpVar<VarImp>::assigned(void) const {
     return x->assigned();
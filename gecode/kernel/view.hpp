@@ -54,6 +54,10 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Return activity
+    double activity(void) const;
+    /// Start recording activity in \a home
+    void activity(Space& home);
     /// Return whether this view is derived from a VarImpView
     static bool varderived(void);
     /// Return dummy variable implementation of view
@@ -138,6 +142,10 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Return activity
+    double activity(void) const;
+    /// Start recording activity in \a home
+    void activity(Space& home);
     //@}
 
     /// \name Domain tests
@@ -231,6 +239,10 @@ namespace Gecode {
     unsigned int degree(void) const;
     /// Return accumulated failure count (plus degree)
     double afc(void) const;
+    /// Return activity
+    double activity(void) const;
+    /// Start recording activity in \a home
+    void activity(Space& home);
     //@}
 
     /// \name Domain tests
@@ -352,6 +364,14 @@ namespace Gecode {
     return 0.0;
   }
   template<class View>
+  forceinline double
+  ConstView<View>::activity(void) const {
+    return 0.0;
+  }
+  template<class View>
+  forceinline void
+  ConstView<View>::activity(Space&) {}
+  template<class View>
   forceinline bool
   ConstView<View>::varderived(void) {
     return false;
@@ -443,6 +463,16 @@ namespace Gecode {
     return x->afc();
   }
   template<class Var>
+  forceinline double
+  VarImpView<Var>::activity(void) const {
+    return x->activity();
+  }
+  template<class Var>
+  forceinline void
+  VarImpView<Var>::activity(Space& home) {
+    x->activity(home);
+  }
+  template<class Var>
   forceinline bool
   VarImpView<Var>::assigned(void) const {
     return x->assigned();
@@ -537,6 +567,16 @@ namespace Gecode {
     return x.afc();
   }
   template<class View>
+  forceinline double
+  DerivedView<View>::activity(void) const {
+    return x.activity();
+  }
+  template<class View>
+  forceinline void
+  DerivedView<View>::activity(Space& home) {
+    x.activity(home);
+  }
+  template<class View>
   forceinline bool
   DerivedView<View>::assigned(void) const {
     return x.assigned();
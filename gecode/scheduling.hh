@@ -406,6 +406,13 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs 
+   * time-table edge-finding, following:
+   *
+   * Petr Vilm, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, 
+   * CPAIOR, volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -414,7 +421,8 @@ namespace Gecode {
    */
   GECODE_SCHEDULING_EXPORT void
   cumulative(Home home, int c, const TaskTypeArgs& t,
-             const IntVarArgs& flex, const IntArgs& fix, const IntArgs& u);
+             const IntVarArgs& flex, const IntArgs& fix, const IntArgs& u,
+             IntConLevel icl=ICL_DEF);
 
   /** \brief Post propagators for scheduling optional tasks on cumulative resources
    *
@@ -446,6 +454,13 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs 
+   * time-table edge-finding, following:
+   *
+   * Petr Vilm, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, 
+   * CPAIOR, volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -455,7 +470,7 @@ namespace Gecode {
   GECODE_SCHEDULING_EXPORT void
   cumulative(Home home, int c, const TaskTypeArgs& t,
              const IntVarArgs& s, const IntArgs& p, const IntArgs& u,
-             const BoolVarArgs& m);
+             const BoolVarArgs& m, IntConLevel icl=ICL_DEF);
 
   /** \brief Post propagators for scheduling tasks on cumulative resources
    *
@@ -475,6 +490,13 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs 
+   * time-table edge-finding, following:
+   *
+   * Petr Vilm, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, 
+   * CPAIOR, volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -483,7 +505,7 @@ namespace Gecode {
    */
   GECODE_SCHEDULING_EXPORT void
   cumulative(Home home, int c, const IntVarArgs& s, const IntArgs& p,
-             const IntArgs& u);
+             const IntArgs& u, IntConLevel icl=ICL_DEF);
 
   /** \brief Post propagators for scheduling optional tasks on cumulative resources
    *
@@ -505,6 +527,13 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs 
+   * time-table edge-finding, following:
+   *
+   * Petr Vilm, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, 
+   * CPAIOR, volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -513,7 +542,8 @@ namespace Gecode {
    */
   GECODE_SCHEDULING_EXPORT void
   cumulative(Home home, int c, const IntVarArgs& s, const IntArgs& p, 
-             const IntArgs& u, const BoolVarArgs& m);
+             const IntArgs& u, const BoolVarArgs& m, 
+             IntConLevel icl=ICL_DEF);
 
   /** \brief Post propagators for scheduling tasks on cumulative resources
    *
@@ -537,6 +567,13 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs 
+   * time-table edge-finding, following:
+   *
+   * Petr Vilm, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, 
+   * CPAIOR, volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -545,7 +582,8 @@ namespace Gecode {
    */
   GECODE_SCHEDULING_EXPORT void
   cumulative(Home home, int c, const IntVarArgs& s, const IntVarArgs& p,
-             const IntVarArgs& e, const IntArgs& u);
+             const IntVarArgs& e, const IntArgs& u, 
+             IntConLevel icl=ICL_DEF);
 
   /** \brief Post propagators for scheduling optional tasks on cumulative resources
    *
@@ -571,6 +609,13 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator additionally performs 
+   * time-table edge-finding, following:
+   *
+   * Petr Vilm, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, 
+   * CPAIOR, volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -579,7 +624,8 @@ namespace Gecode {
    */
   GECODE_SCHEDULING_EXPORT void
   cumulative(Home home, int c, const IntVarArgs& s, const IntVarArgs& p, 
-             const IntVarArgs& e, const IntArgs& u, const BoolVarArgs& m);
+             const IntVarArgs& e, const IntArgs& u, const BoolVarArgs& m,
+             IntConLevel icl=ICL_DEF);
   //@}
 
 }
@@ -43,7 +43,8 @@ namespace Gecode {
 
   void
   cumulative(Home home, int c, const TaskTypeArgs& t,
-             const IntVarArgs& s, const IntArgs& p, const IntArgs& u) {
+             const IntVarArgs& s, const IntArgs& p, const IntArgs& u,
+             IntConLevel icl) {
     using namespace Gecode::Scheduling;
     using namespace Gecode::Scheduling::Cumulative;
     if ((s.size() != p.size()) || (s.size() != u.size()) ||
@@ -71,19 +72,21 @@ namespace Gecode {
       TaskArray<ManFixPTask> tasks(home,s.size());
       for (int i=0; i<s.size(); i++)
         tasks[i].init(s[i],p[i],u[i]);
-      GECODE_ES_FAIL(ManProp<ManFixPTask>::post(home,c,tasks));
+      GECODE_ES_FAIL(ManProp<ManFixPTask>::post(home,c,tasks,
+                                                   icl == ICL_DOM));
     } else {
       TaskArray<ManFixPSETask> tasks(home,s.size());
       for (int i=s.size(); i--;)
         tasks[i].init(t[i],s[i],p[i],u[i]);
-      GECODE_ES_FAIL(ManProp<ManFixPSETask>::post(home,c,tasks));
+      GECODE_ES_FAIL(ManProp<ManFixPSETask>::post(home,c,tasks,
+                                                   icl == ICL_DOM));
     }
   }
 
   void
   cumulative(Home home, int c, const TaskTypeArgs& t,
              const IntVarArgs& s, const IntArgs& p, const IntArgs& u,
-             const BoolVarArgs& m) {
+             const BoolVarArgs& m, IntConLevel icl) {
     using namespace Gecode::Scheduling;
     using namespace Gecode::Scheduling::Cumulative;
     if ((s.size() != p.size()) || (s.size() != u.size()) ||
@@ -111,17 +114,19 @@ namespace Gecode {
       TaskArray<OptFixPTask> tasks(home,s.size());
       for (int i=0; i<s.size(); i++)
         tasks[i].init(s[i],p[i],u[i],m[i]);
-      GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,c,tasks));
+      GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,c,tasks,
+                                                   icl == ICL_DOM));
     } else {
       TaskArray<OptFixPSETask> tasks(home,s.size());
       for (int i=s.size(); i--;)
         tasks[i].init(t[i],s[i],p[i],u[i],m[i]);
-      GECODE_ES_FAIL(OptProp<OptFixPSETask>::post(home,c,tasks));
+      GECODE_ES_FAIL(OptProp<OptFixPSETask>::post(home,c,tasks,
+                                                   icl == ICL_DOM));
     }
   }
   void
   cumulative(Home home, int c, const IntVarArgs& s, 
-             const IntArgs& p, const IntArgs& u) {
+             const IntArgs& p, const IntArgs& u, IntConLevel icl) {
     using namespace Gecode::Scheduling;
     using namespace Gecode::Scheduling::Cumulative;
     if ((s.size() != p.size()) || (s.size() != u.size()))
@@ -143,12 +148,12 @@ namespace Gecode {
     for (int i=0; i<s.size(); i++) {
       t[i].init(s[i],p[i],u[i]);
     }
-    GECODE_ES_FAIL(ManProp<ManFixPTask>::post(home,c,t));
+    GECODE_ES_FAIL(ManProp<ManFixPTask>::post(home,c,t,icl == ICL_DOM));
   }
 
   void
   cumulative(Home home, int c, const IntVarArgs& s, const IntArgs& p, 
-             const IntArgs& u, const BoolVarArgs& m) {
+             const IntArgs& u, const BoolVarArgs& m, IntConLevel icl) {
     using namespace Gecode::Scheduling;
     using namespace Gecode::Scheduling::Cumulative;
     if ((s.size() != p.size()) || (s.size() != u.size()) ||
@@ -171,13 +176,13 @@ namespace Gecode {
     for (int i=0; i<s.size(); i++) {
       t[i].init(s[i],p[i],u[i],m[i]);
     }
-    GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,c,t));
+    GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,c,t,icl == ICL_DOM));
   }
 
   void
   cumulative(Home home, int c, const IntVarArgs& s, 
              const IntVarArgs& p, const IntVarArgs& e,
-             const IntArgs& u) {
+             const IntArgs& u, IntConLevel icl) {
     using namespace Gecode::Scheduling;
     using namespace Gecode::Scheduling::Cumulative;
     if ((s.size() != p.size()) || (s.size() != e.size()) ||
@@ -201,12 +206,13 @@ namespace Gecode {
     TaskArray<ManFlexTask> t(home,s.size());
     for (int i=s.size(); i--; )
       t[i].init(s[i],p[i],e[i],u[i]);
-    GECODE_ES_FAIL(ManProp<ManFlexTask>::post(home,c,t));
+    GECODE_ES_FAIL(ManProp<ManFlexTask>::post(home,c,t,icl == ICL_DOM));
   }
 
   void
   cumulative(Home home, int c, const IntVarArgs& s, const IntVarArgs& p,
-             const IntVarArgs& e, const IntArgs& u, const BoolVarArgs& m) {
+             const IntVarArgs& e, const IntArgs& u, const BoolVarArgs& m,
+             IntConLevel icl) {
     using namespace Gecode::Scheduling;
     using namespace Gecode::Scheduling::Cumulative;
     if ((s.size() != p.size()) || (s.size() != u.size()) ||
@@ -230,7 +236,7 @@ namespace Gecode {
     TaskArray<OptFlexTask> t(home,s.size());
     for (int i=s.size(); i--; )
       t[i].init(s[i],p[i],e[i],u[i],m[i]);
-    GECODE_ES_FAIL(OptProp<OptFlexTask>::post(home,c,t));
+    GECODE_ES_FAIL(OptProp<OptFlexTask>::post(home,c,t,icl == ICL_DOM));
   }
   
 }
@@ -51,6 +51,13 @@
  *   Petr Vilm, Edge Finding Filtering Algorithm for Discrete
  *   Cumulative Resources in O(kn log n), CP, 2009.
  *
+ * The time-table edge-finding algorithm follows:
+ *   Petr Vilm, Timetable Edge Finding Filtering Algorithm for
+ *   Discrete Cumulative Resources, CP-AI-OR, 2011.
+ *   Andreas Schutt, Thibaut Feydy, Peter J. Stuckey, Explaining
+ *   Time-Table-Edge-Finding Propagation for the Cumulative Resource
+ *   Constraint, CP-AI-OR, 2013.
+ *
  * \brief %Scheduling for cumulative resources
  */
 
@@ -646,9 +653,45 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
 
 namespace Gecode { namespace Scheduling { namespace Cumulative {
 
-  /// Perform basic propagation
+  /**
+   * \brief Order of events for basic propagation
+   *
+   * Basic propagation creates four events per task, where tasks are
+   * identified by their position in the task array. The task array is
+   * sorted by decreasing capacity when the propagator is created and
+   * keeps this order. Only the order of the events after the last
+   * execution is stored: the events are recreated in this order and
+   * only the events that are out of order must be sorted.
+   *
+   * The order is not copied during cloning: the first execution
+   * after cloning sorts all events.
+   */
+  class EventOrder {
+  public:
+    /// Number of events
+    int n;
+    /// Events as four times task position plus event number
+    int* o;
+    /// Default constructor
+    EventOrder(void);
+    /// Initialize for \a n tasks
+    void init(Space& home, int n);
+    /// Update during cloning from \a eo (does not copy the order)
+    void update(Space& home, bool share, EventOrder& eo);
+  };
+
+  /// Sort tasks \a t by decreasing capacity as required by basic propagation
+  template<class Task>
+  void sortcap(TaskArray<Task>& t);
+
+  /**
+   * \brief Perform basic propagation
+   *
+   * The tasks \a t must be sorted by decreasing capacity.
+   */
   template<class Task>
-  ExecStatus basic(Space& home, Propagator& p, int c, TaskArray<Task>& t);
+  ExecStatus basic(Space& home, Propagator& p, int c, TaskArray<Task>& t,
+                   EventOrder& eo);
 
   /// Check mandatory tasks \a t for overload
   template<class ManTask>
@@ -658,6 +701,10 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
 
+  /// Propagate by time-table edge finding
+  template<class Task>
+  ExecStatus ttedgefinding(Space& home, int c, TaskArray<Task>& t);
+
   /**
    * \brief Scheduling propagator for cumulative resource with mandatory tasks
    *
@@ -670,8 +717,12 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     using TaskProp<ManTask,Int::PC_INT_DOM>::t;
     /// Resource capacity
     int c;
+    /// Order of events for basic propagation
+    EventOrder eo;
+    /// Whether to perform time-table edge finding
+    bool ttef;
     /// Constructor for creation
-    ManProp(Home home, int c, TaskArray<ManTask>& t);
+    ManProp(Home home, int c, TaskArray<ManTask>& t, bool ttef);
     /// Constructor for cloning \a p
     ManProp(Space& home, bool shared, ManProp& p);
   public:
@@ -679,8 +730,13 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     virtual Actor* copy(Space& home, bool share);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, int c, TaskArray<ManTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on cumulative resource
+     *
+     * If \a ttef is true, time-table edge finding is performed in
+     * addition to edge finding.
+     */
+    static ExecStatus post(Home home, int c, TaskArray<ManTask>& t, bool ttef);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -697,8 +753,12 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     using TaskProp<OptTask,Int::PC_INT_DOM>::t;
     /// Resource capacity
     int c;
+    /// Order of events for basic propagation
+    EventOrder eo;
+    /// Whether to perform time-table edge finding
+    bool ttef;
     /// Constructor for creation
-    OptProp(Home home, int c, TaskArray<OptTask>& t);
+    OptProp(Home home, int c, TaskArray<OptTask>& t, bool ttef);
     /// Constructor for cloning \a p
     OptProp(Space& home, bool shared, OptProp& p);
   public:
@@ -706,8 +766,13 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     virtual Actor* copy(Space& home, bool share);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, int c, TaskArray<OptTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on cumulative resource
+     *
+     * If \a ttef is true, time-table edge finding is performed in
+     * addition to edge finding.
+     */
+    static ExecStatus post(Home home, int c, TaskArray<OptTask>& t, bool ttef);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -717,6 +782,7 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
 #include <gecode/scheduling/cumulative/basic.hpp>
 #include <gecode/scheduling/cumulative/overload.hpp>
 #include <gecode/scheduling/cumulative/edge-finding.hpp>
+#include <gecode/scheduling/cumulative/tt-edge-finding.hpp>
 #include <gecode/scheduling/cumulative/man-prop.hpp>
 #include <gecode/scheduling/cumulative/opt-prop.hpp>
 
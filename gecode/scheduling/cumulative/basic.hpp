@@ -47,11 +47,12 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
       EST = 2, ///< Earliest start time of task
       ZRO = 3, ///< Zero-length task start time
       ERT = 4, ///< Earliest required time of task
-      END = 5  ///< End marker
+      END = 5  ///< End marker (also for events not in use)
     };
     Type e; ///< Type of event
     int t;  ///< Time of event
     int i;  ///< Number of task
+    int k;  ///< Which of the four events of task \a i
     /// Initialize event
     void init(Type e, int t, int i);
     /// Order among events
@@ -84,56 +85,124 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     return t1.c() > t2.c();
   }
 
+  template<class Task>
+  forceinline void
+  sortcap(TaskArray<Task>& t) {
+    TaskByDecCap<Task> tbdc;
+    Support::quicksort(&t[0], t.size(), tbdc);
+  }
+
+
+  /*
+   * Order of events
+   *
+   */
+  forceinline
+  EventOrder::EventOrder(void) : n(0), o(NULL) {}
+
+  forceinline void
+  EventOrder::init(Space& home, int n0) {
+    n = 4*n0;
+    o = home.alloc<int>(n);
+    for (int i=n; i--; )
+      o[i] = i;
+  }
+
+  forceinline void
+  EventOrder::update(Space&, bool, EventOrder&) {
+    n = 0; o = NULL;
+  }
+
 
   // Basic propagation
   template<class Task>
   ExecStatus
-  basic(Space& home, Propagator& p, int c, TaskArray<Task>& t) {
-    // Sort tasks by decreasing capacity
-    TaskByDecCap<Task> tbdc;
-    Support::quicksort(&t[0], t.size(), tbdc);
+  basic(Space& home, Propagator& p, int c, TaskArray<Task>& t,
+        EventOrder& eo) {
+    int n = 4*t.size();
+    if (n != eo.n) {
+      // No order after cloning or tasks have been removed
+      if (eo.n > 0)
+        home.free<int>(eo.o,eo.n);
+      eo.init(home,t.size());
+    }
 
     Region r(home);
 
-    Event* e = r.alloc<Event>(4*t.size()+1);
+    Event* e = r.alloc<Event>(n+1);
 
-    // Initialize events
     bool assigned=true;
     {
       bool required=false;
-      int n=0;
-      for (int i=t.size(); i--; ) 
-        if (t[i].assigned()) {
+      // Create events in the order of the last execution
+      for (int j=0; j<n; j++) {
+        int i = eo.o[j] >> 2, k = eo.o[j] & 3;
+        const Task& ti = t[i];
+        Event::Type et = Event::END;
+        int time = Int::Limits::infinity;
+        if (ti.excluded()) {
+          // Excluded tasks have no events
+        } else if (ti.assigned()) {
           // Only add required part
-          if (t[i].pmin() > 0) {
-            required = true;
-            e[n++].init(Event::ERT,t[i].lst(),i);
-            e[n++].init(Event::LRT,t[i].ect(),i);
-          } else if (t[i].pmax() == 0) {
-            required = true;
-            e[n++].init(Event::ZRO,t[i].lst(),i);
+          if (ti.pmin() > 0) {
+            if (k == 2) {
+              et = Event::ERT; time = ti.lst();
+            } else if (k == 3) {
+              et = Event::LRT; time = ti.ect();
+            }
+          } else if ((ti.pmax() == 0) && (k == 2)) {
+            et = Event::ZRO; time = ti.lst();
           }
         } else {
           assigned = false;
-          e[n++].init(Event::EST,t[i].est(),i);
-          e[n++].init(Event::LCT,t[i].lct(),i);
-          // Check whether task has required part
-          if (t[i].lst() < t[i].ect()) {
-            required = true;
-            e[n++].init(Event::ERT,t[i].lst(),i);
-            e[n++].init(Event::LRT,t[i].ect(),i);
+          switch (k) {
+          case 0: et = Event::EST; time = ti.est(); break;
+          case 1: et = Event::LCT; time = ti.lct(); break;
+          default:
+            // Check whether task has required part
+            if (ti.lst() < ti.ect()) {
+              if (k == 2) {
+                et = Event::ERT; time = ti.lst();
+              } else {
+                et = Event::LRT; time = ti.ect();
+              }
+            }
           }
         }
-      
+        if ((et == Event::ERT) || (et == Event::ZRO))
+          required = true;
+        e[j].init(et,time,i); e[j].k = k;
+      }
+
       // Check whether no task has a required part
       if (!required)
         return assigned ? home.ES_SUBSUMED(p) : ES_FIX;
-      
-      // Write end marker
-      e[n++].init(Event::END,Int::Limits::infinity,-1);
-      
-      // Sort events
-      Support::quicksort(e, n);
+
+      // Keep events that are in order with respect to their neighbours
+      Event* oe = r.alloc<Event>(n);
+      int m=0, u=0;
+      for (int j=0; j<n; j++)
+        if (((u == 0) || !(e[j] < e[u-1])) &&
+            ((j+1 == n) || !(e[j+1] < e[j])))
+          e[u++] = e[j];
+        else
+          oe[m++] = e[j];
+
+      // Sort the other events and merge them with the kept events
+      if (m > 0) {
+        Support::quicksort(oe, m);
+        int i=u-1, j=m-1, w=n-1;
+        while (j >= 0)
+          if ((i >= 0) && (oe[j] < e[i]))
+            e[w--] = e[i--];
+          else
+            e[w--] = oe[j--];
+      }
+      e[n].init(Event::END,Int::Limits::infinity,-1);
+
+      // Remember order for the next execution
+      for (int j=n; j--; )
+        eo.o[j] = 4*e[j].i + e[j].k;
     }
 
     // Set of current but not required tasks
@@ -39,24 +39,31 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
   
   template<class ManTask>
   forceinline
-  ManProp<ManTask>::ManProp(Home home, int c0, TaskArray<ManTask>& t)
-    : TaskProp<ManTask,Int::PC_INT_DOM>(home,t), c(c0) {}
+  ManProp<ManTask>::ManProp(Home home, int c0, TaskArray<ManTask>& t,
+                            bool ttef0)
+    : TaskProp<ManTask,Int::PC_INT_DOM>(home,t), c(c0), ttef(ttef0) {
+    sortcap(t);
+  }
 
   template<class ManTask>
   forceinline
   ManProp<ManTask>::ManProp(Space& home, bool shared, 
                             ManProp<ManTask>& p) 
-    : TaskProp<ManTask,Int::PC_INT_DOM>(home,shared,p), c(p.c) {}
+    : TaskProp<ManTask,Int::PC_INT_DOM>(home,shared,p), c(p.c), 
+      ttef(p.ttef) {
+    eo.update(home,shared,p.eo);
+  }
 
   template<class ManTask>
   forceinline ExecStatus 
-  ManProp<ManTask>::post(Home home, int c, TaskArray<ManTask>& t) {
+  ManProp<ManTask>::post(Home home, int c, TaskArray<ManTask>& t,
+                         bool ttef) {
     // Check that tasks do not overload resource
     for (int i=t.size(); i--; )
       if (t[i].c() > c)
         return ES_FAILED;
     if (t.size() > 1)
-      (void) new (home) ManProp<ManTask>(home,c,t);
+      (void) new (home) ManProp<ManTask>(home,c,t,ttef);
     return ES_OK;
   }
 
@@ -79,8 +86,15 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     // Only bounds changes?
     if (Int::IntView::me(med) != Int::ME_INT_DOM)
       GECODE_ES_CHECK(overload(home,c,t));
-    GECODE_ES_CHECK(edgefinding(home,c,t));
-    return basic(home,*this,c,t);
+    {
+      // Edge finding sorts the tasks, basic propagation needs their order
+      Region r(home);
+      TaskArray<ManTask> s(r,t);
+      GECODE_ES_CHECK(edgefinding(home,c,s));
+      if (ttef)
+        GECODE_ES_CHECK(ttedgefinding(home,c,s));
+    }
+    return basic(home,*this,c,t,eo);
   }
 
 }}}
@@ -41,17 +41,24 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
   
   template<class OptTask>
   forceinline
-  OptProp<OptTask>::OptProp(Home home, int c0, TaskArray<OptTask>& t)
-    : TaskProp<OptTask,Int::PC_INT_DOM>(home,t), c(c0) {}
+  OptProp<OptTask>::OptProp(Home home, int c0, TaskArray<OptTask>& t,
+                            bool ttef0)
+    : TaskProp<OptTask,Int::PC_INT_DOM>(home,t), c(c0), ttef(ttef0) {
+    sortcap(t);
+  }
 
   template<class OptTask>
   forceinline
   OptProp<OptTask>::OptProp(Space& home, bool shared, OptProp<OptTask>& p) 
-    : TaskProp<OptTask,Int::PC_INT_DOM>(home,shared,p), c(p.c) {}
+    : TaskProp<OptTask,Int::PC_INT_DOM>(home,shared,p), c(p.c),
+      ttef(p.ttef) {
+    eo.update(home,shared,p.eo);
+  }
 
   template<class OptTask>
   forceinline ExecStatus 
-  OptProp<OptTask>::post(Home home, int c, TaskArray<OptTask>& t) {
+  OptProp<OptTask>::post(Home home, int c, TaskArray<OptTask>& t,
+                         bool ttef) {
     // Check for overload by single task and remove excluded tasks
     int n=t.size(), m=0;
     for (int i=n; i--; ) {
@@ -69,9 +76,10 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
       TaskArray<typename TaskTraits<OptTask>::ManTask> mt(home,m);
       for (int i=m; i--; )
         mt[i].init(t[i]);
-      return ManProp<typename TaskTraits<OptTask>::ManTask>::post(home,c,mt);
+      return ManProp<typename TaskTraits<OptTask>::ManTask>
+        ::post(home,c,mt,ttef);
     }
-    (void) new (home) OptProp<OptTask>(home,c,t);
+    (void) new (home) OptProp<OptTask>(home,c,t,ttef);
     return ES_OK;
   }
 
@@ -98,24 +106,21 @@ namespace Gecode { namespace Scheduling { namespace Cumulative {
     if (Int::IntView::me(med) != Int::ME_INT_DOM)
       GECODE_ES_CHECK(overload(home,c,t));
 
-    GECODE_ES_CHECK(basic(home,*this,c,t));
+    GECODE_ES_CHECK(basic(home,*this,c,t,eo));
 
-    // Partition into mandatory and optional activities
-    int n = t.size();
-    int i=0, j=n-1;
-    while (true) {
-      while ((i < n) && t[i].mandatory()) i++;
-      while ((j >= 0) && !t[j].mandatory()) j--;
-      if (i >= j) break;
-      std::swap(t[i],t[j]);
-    }
+    // Collect mandatory tasks, basic propagation needs the order of t
+    Region r(home);
+    TaskArray<OptTask> m(r,t.size());
+    int n=0;
+    for (int i=0; i<t.size(); i++)
+      if (t[i].mandatory())
+        m[n++] = t[i];
 
-    if (i > 1) {
-      // Truncate array to only contain mandatory tasks
-      t.size(i);
-      GECODE_ES_CHECK(edgefinding(home,c,t));
-      // Restore to also include optional tasks
-      t.size(n);
+    if (n > 1) {
+      m.size(n);
+      GECODE_ES_CHECK(edgefinding(home,c,m));
+      if (ttef)
+        GECODE_ES_CHECK(ttedgefinding(home,c,m));
     }
 
     return ES_NOFIX;
@@ -0,0 +1,211 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include <algorithm>
+
+namespace Gecode { namespace Scheduling { namespace Cumulative {
+
+  /// Start or end of a compulsory part
+  class CompEvent {
+  public:
+    /// Time of event
+    int t;
+    /// Change in resource usage at time \a t
+    int c;
+    /// Order by time
+    bool operator <(const CompEvent& e) const {
+      return t < e.t;
+    }
+  };
+
+  /// Energy profile of the compulsory parts of tasks
+  class CompProfile {
+  protected:
+    /// Number of distinct event times
+    int n;
+    /// Event times in increasing order
+    int* t;
+    /// Energy of compulsory parts before the event time
+    double* e;
+    /// Resource usage starting at the event time
+    int* h;
+  public:
+    /// Initialize profile for tasks \a tv
+    template<class TaskView>
+    CompProfile(Region& r, const TaskViewArray<TaskView>& tv) {
+      CompEvent* ce = r.alloc<CompEvent>(2*tv.size());
+      int m = 0;
+      for (int i=tv.size(); i--; )
+        if ((tv[i].lst() < tv[i].ect()) && (tv[i].c() > 0)) {
+          ce[m].t = tv[i].lst(); ce[m].c = tv[i].c(); m++;
+          ce[m].t = tv[i].ect(); ce[m].c = -tv[i].c(); m++;
+        }
+      Support::quicksort(ce, m);
+      t = r.alloc<int>(m); e = r.alloc<double>(m); h = r.alloc<int>(m);
+      n = 0;
+      for (int i=0, u=0; i<m; i++) {
+        u += ce[i].c;
+        if ((n > 0) && (t[n-1] == ce[i].t)) {
+          h[n-1] = u;
+        } else {
+          e[n] = (n == 0) ? 0.0 :
+            e[n-1] + static_cast<double>(h[n-1]) * 
+            (static_cast<double>(ce[i].t) - t[n-1]);
+          t[n] = ce[i].t; h[n] = u; n++;
+        }
+      }
+    }
+    /// Return energy of compulsory parts before time \a x
+    double energy(int x) const {
+      if ((n == 0) || (x <= t[0]))
+        return 0.0;
+      // Find last event time not after x
+      int l = 0, r = n-1;
+      while (l < r) {
+        int m = l + (r-l+1) / 2;
+        if (t[m] <= x)
+          l = m;
+        else
+          r = m-1;
+      }
+      return e[l] + static_cast<double>(h[l]) * 
+        (static_cast<double>(x) - t[l]);
+    }
+  };
+
+  /*
+   * The time-table edge-finding rule considers the energy that is
+   * required in a time window [a,b) by the compulsory parts of all
+   * tasks and by the free parts (that is, the part of the processing
+   * time not covered by the compulsory part) of all tasks that must
+   * be executed entirely in [a,b). If this exceeds the energy of the
+   * window, the resource is overloaded. Otherwise, a task that ends
+   * after b and that starts not earlier than a can only use as much
+   * of the remaining energy in [a,b) as its start time allows. For
+   * each window, only the task that would consume most energy in the
+   * window when scheduled at its earliest start time is considered.
+   */
+  template<class TaskView>
+  forceinline ExecStatus
+  ttedgefinding(Space& home, int c, TaskViewArray<TaskView>& t) {
+    int n = t.size();
+    Region r(home);
+
+    CompProfile cp(r,t);
+
+    // Minimal processing time not covered by the compulsory part
+    double* pf = r.alloc<double>(n);
+    // Compulsory part energy before est and lct
+    double* eest = r.alloc<double>(n);
+    double* elct = r.alloc<double>(n);
+    // New earliest start times
+    int* est = r.alloc<int>(n);
+    for (int i=n; i--; ) {
+      pf[i] = std::max(0.0, t[i].pmin() - 
+                       std::max(0.0, static_cast<double>(t[i].ect()) 
+                                - t[i].lst()));
+      eest[i] = cp.energy(t[i].est());
+      elct[i] = cp.energy(t[i].lct());
+      est[i] = t[i].est();
+    }
+
+    int* s = r.alloc<int>(n);
+    sort<TaskView,STO_EST,true>(s, t);
+    int* e = r.alloc<int>(n);
+    sort<TaskView,STO_LCT,true>(e, t);
+
+    for (int k=n; k--; ) {
+      int j = e[k];
+      int b = t[j].lct();
+      // Consider each end of a time window only once
+      if ((k+1 < n) && (t[e[k+1]].lct() == b))
+        continue;
+      // Free energy of tasks that must run in the window
+      double en = 0.0;
+      // Task that requires most energy in the window and its energy
+      int u = -1;
+      double en_u = 0.0;
+      for (int l=n; l--; ) {
+        int i = s[l];
+        int a = t[i].est();
+        if (a >= b)
+          continue;
+        if (t[i].lct() <= b) {
+          en += static_cast<double>(t[i].c()) * pf[i];
+        } else if (t[i].c() > 0) {
+          double cp_i = std::max(0.0, static_cast<double>
+                                 (std::min(b, t[i].ect())) - t[i].lst());
+          double en_i = static_cast<double>(t[i].c()) *
+            (std::min(static_cast<double>(t[i].pmin()), 
+                      static_cast<double>(b) - a) - cp_i);
+          if (en_i > en_u) {
+            en_u = en_i; u = i;
+          }
+        }
+        double avail = static_cast<double>(c) * 
+          (static_cast<double>(b) - a) - (elct[j] - eest[i]) - en;
+        if (avail < 0.0)
+          return ES_FAILED;
+        if (en_u > avail) {
+          double cp_u = std::max(0.0, static_cast<double>
+                                 (std::min(b, t[u].ect())) - t[u].lst());
+          // The new start time lies strictly between est and b
+          int s_u = static_cast<int>(b - cp_u - floor(avail / t[u].c()));
+          est[u] = std::max(est[u], s_u);
+        }
+      }
+    }
+
+    for (int i=n; i--; )
+      if (est[i] > t[i].est())
+        GECODE_ME_CHECK(t[i].est(home,est[i]));
+
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  ttedgefinding(Space& home, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(ttedgefinding(home,c,f));
+    TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(ttedgefinding(home,c,b));
+    return ES_OK;
+  }
+    
+}}}
+
+// STATISTICS: scheduling-prop
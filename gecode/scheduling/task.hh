@@ -177,6 +177,10 @@ namespace Gecode { namespace Scheduling {
     TaskArray(void);
     /// Allocate memory for \a n tasks (no initialization)
     TaskArray(Space& home, int n);
+    /// Allocate memory for \a n tasks from region \a r (no initialization)
+    TaskArray(Region& r, int n);
+    /// Initialize with copy of tasks \a a allocated from region \a r
+    TaskArray(Region& r, const TaskArray<Task>& a);
     /// Initialize from task array \a a (share elements)
     TaskArray(const TaskArray<Task>& a);
     /// Initialize from task array \a a (share elements)
@@ -53,6 +53,19 @@ namespace Gecode { namespace Scheduling {
   }
   template<class Task>
   forceinline
+  TaskArray<Task>::TaskArray(Region& r, int n0)
+    : n(n0), t(r.alloc<Task>(n)) {
+    assert(n > 0);
+  }
+  template<class Task>
+  forceinline
+  TaskArray<Task>::TaskArray(Region& r, const TaskArray<Task>& a)
+    : n(a.n), t(r.alloc<Task>(n)) {
+    for (int i=n; i--; )
+      t[i]=a.t[i];
+  }
+  template<class Task>
+  forceinline
   TaskArray<Task>::TaskArray(const TaskArray<Task>& a)
     : n(a.n), t(a.t) {}
   template<class Task>
@@ -40,11 +40,13 @@ namespace Gecode { namespace Scheduling {
   template<class OptTask, PropCond pc>
   ExecStatus
   purge(Space& home, Propagator& p, TaskArray<OptTask>& t) {
-    int n=t.size();
-    for (int i=n; i--; )
-      if (t[i].excluded()) {
-        t[i].cancel(home,p,pc); t[i]=t[--n];
-      }
+    // Keep the order of the remaining tasks
+    int n=0;
+    for (int i=0; i<t.size(); i++)
+      if (t[i].excluded())
+        t[i].cancel(home,p,pc);
+      else
+        t[n++]=t[i];
     t.size(n);
 
     return (t.size() < 2) ? home.ES_SUBSUMED(p) : ES_OK;
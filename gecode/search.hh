@@ -91,10 +91,21 @@ namespace Gecode {
       const unsigned int c_d = 8;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       const unsigned int a_d = 2;
+      /// Discrepancy limit for limited discrepancy search
+      const unsigned int d_l = 5;
+      /// Whether worker threads are bound to processing units
+      const bool pin = false;
+      /// Number of neighboring workers preferred for stealing (0 for none)
+      const unsigned int locality = 0;
 
       /// Minimal number of open nodes for stealing
       const unsigned int steal_limit = 3;
-      /// Initial delay in milliseconds for all but first worker thread
+      /**
+       * \brief Initial delay in milliseconds for all but first worker thread
+       *
+       * \deprecated Not used anymore: idle workers sleep until some
+       * other worker has work to be stolen.
+       */
       const unsigned int initial_delay = 5;
     }
 
@@ -102,7 +113,7 @@ namespace Gecode {
      * \brief %Search engine statistics
      * \ingroup TaskModelSearch
      */
-    class Statistics : public StatusStatistics {
+    class Statistics : public StatusStatistics, public CloneStatistics {
     public:
       /// Number of failed nodes in search tree
       unsigned long int fail;
@@ -123,6 +134,8 @@ namespace Gecode {
     };
 
     class Stop;
+    class Cutoff;
+    class Sink;
 
     /**
      * \brief %Search engine options
@@ -146,6 +159,13 @@ namespace Gecode {
      * Full copying corresponds to a maximal recomputation distance
      * \a c_d of 1.
      *
+     * The discrepancy limit \a d_l is only used by limited discrepancy
+     * search (see LDS): it defines the maximal number of discrepancies
+     * along a path explored.
+     *
+     * The cutoff \a cutoff is only used by restart-based search (see
+     * RBS): it defines after how many failures search is restarted.
+     *
      * All recomputation performed is based on batch recomputation: batch
      * recomputation performs propagation only once for an entire path
      * used in recomputation.
@@ -171,8 +191,61 @@ namespace Gecode {
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /// Discrepancy limit (for LDS)
+      unsigned int d_l;
+      /**
+       * \brief Whether to bind worker threads to processing units
+       *
+       * Worker \f$i\f$ of a parallel engine is bound to processing
+       * unit \f$i\f$. Memory allocated by a worker is then likely to
+       * be local to the processing unit it runs on.
+       */
+      bool pin;
+      /**
+       * \brief Number of neighboring workers preferred for stealing
+       *
+       * The workers of a parallel engine are partitioned into groups
+       * of \a locality consecutive workers. An idle worker tries to
+       * steal from the workers in its own group first. When also using
+       * \a pin, \a locality should be the number of processing units
+       * per socket (assuming that consecutive processing units share
+       * a socket). If \a locality is zero, all workers form one group.
+       */
+      unsigned int locality;
       /// Stop object for stopping search
       Stop* stop;
+      /// Cutoff for restart-based search
+      Cutoff* cutoff;
+      /**
+       * \brief Depth limit for no-goods recorded on restart
+       *
+       * When restart-based search restarts, no-goods are extracted
+       * from the first \a nogoods_limit levels of the current search
+       * path and posted on the root space. If \a nogoods_limit is
+       * zero, no no-goods are recorded.
+       */
+      unsigned int nogoods_limit;
+      /**
+       * \brief Memory limit (in bytes) for adapting the commit distance
+       *
+       * If \a memory_limit is not zero, engines treat \a c_d as the
+       * minimal commit distance and increase it at runtime: based on
+       * the size of the clones stored and the maximal depth explored
+       * so far, the commit distance is chosen as small as possible
+       * such that the clones for the remaining depth fit into the
+       * memory limit. When the limit is reached, no further clones
+       * (also none for adaptive recomputation) are created and search
+       * continues by recomputation. The only exception is a path
+       * without any clone (after the last clone has been used for
+       * the last alternative of a node): then a single clone is
+       * created as recomputation must start from it. For parallel
+       * search, the limit applies to each worker.
+       */
+      size_t memory_limit;
+      /// Sink receiving all solutions (NULL if solutions are returned)
+      Sink* sink;
+      /// Profile for recording propagator executions (NULL if none)
+      PropagatorProfile* profile;
       /// Default options
       GECODE_SEARCH_EXPORT static const Options def;
       /// Initialize with default values
@@ -296,6 +369,104 @@ namespace Gecode {
     };
 
 
+    /**
+     * \defgroup TaskModelSearchCutoff Cutoff sequences for restart-based search
+     * \ingroup TaskModelSearch
+     *
+     * A cutoff sequence defines after how many failures restart-based
+     * search restarts: each time search is (re)started, the next value
+     * of the sequence is used as failure limit.
+     */
+
+    /**
+     * \brief Base-class for cutoff sequences
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT Cutoff {
+    public:
+      /// Default constructor
+      Cutoff(void);
+      /// Return next cutoff value
+      virtual unsigned long int operator ()(void) = 0;
+      /// Destructor
+      virtual ~Cutoff(void);
+    };
+
+    /**
+     * \brief Cutoff sequence with constant value
+     *
+     * Note that restart-based search with a constant cutoff is not
+     * complete: if the cutoff is too small, search might restart
+     * forever.
+     *
+     * Throws an exception of type Search::IllegalCutoff if \a c is 0.
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffConstant : public Cutoff {
+    protected:
+      /// Constant cutoff value
+      unsigned long int c;
+    public:
+      /// Use constant cutoff value \a c
+      CutoffConstant(unsigned long int c);
+      /// Return next cutoff value
+      virtual unsigned long int operator ()(void);
+    };
+
+    /**
+     * \brief Cutoff sequence according to Luby
+     *
+     * The sequence is \a scale times the Luby sequence
+     * \f$1,1,2,1,1,2,4,1,1,2,1,1,2,4,8,\ldots\f$, see M. Luby,
+     * A. Sinclair, D. Zuckerman, Optimal speedup of Las Vegas
+     * algorithms, Information Processing Letters, 1993.
+     *
+     * Throws an exception of type Search::IllegalCutoff if \a scale
+     * is 0.
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffLuby : public Cutoff {
+    protected:
+      /// Scale factor
+      unsigned long int s;
+      /// Position in Luby sequence
+      unsigned long int i;
+      /// Return \a i-th element of Luby sequence (with \a i starting at one)
+      static unsigned long int luby(unsigned long int i);
+    public:
+      /// Use Luby sequence scaled by \a scale
+      CutoffLuby(unsigned long int scale=1);
+      /// Return next cutoff value
+      virtual unsigned long int operator ()(void);
+    };
+
+    /**
+     * \brief Cutoff sequence with geometrically increasing values
+     *
+     * The sequence is \f$s, s\cdot b, s\cdot b^2, \ldots\f$ for a
+     * scale factor \f$s\f$ and a base \f$b>1\f$.
+     *
+     * Values that exceed the range of <tt>unsigned long int</tt> are
+     * returned as \c ULONG_MAX.
+     *
+     * Throws an exception of type Search::IllegalCutoff if
+     * \f$s=0\f$ or \f$b\leq 1\f$.
+     * \ingroup TaskModelSearchCutoff
+     */
+    class GECODE_SEARCH_EXPORT CutoffGeometric : public Cutoff {
+    protected:
+      /// Next cutoff value
+      double n;
+      /// Base
+      double b;
+    public:
+      /// Use geometric sequence with scale factor \a scale and base \a base
+      CutoffGeometric(unsigned long int scale=1, double base=1.5);
+      /// Return next cutoff value
+      virtual unsigned long int operator ()(void);
+    };
+
+
     /**
      * \brief %Search engine interface
      */
@@ -307,22 +478,115 @@ namespace Gecode {
       virtual Search::Statistics statistics(void) const = 0;
       /// Check whether engine has been stopped
       virtual bool stopped(void) const = 0;
+      /**
+       * \brief Constrain future solutions to be better than \a b
+       *
+       * Only supported by best solution search engines, all other
+       * engines ignore \a b. Must not be called while the engine
+       * is searching (that is, during execution of next()).
+       */
+      virtual void constrain(const Space& b) { (void) b; }
+      /**
+       * \brief Post no-goods for the current search path on \a home
+       *
+       * The no-goods are extracted from at most \a l levels of the
+       * current search path. Only supported by depth-first search,
+       * all other engines ignore the request.
+       */
+      virtual void nogoods(Space& home, unsigned int l) const {
+        (void) home; (void) l;
+      }
       /// Destructor
       virtual ~Engine(void) {}
     };
 
+    /**
+     * \brief Sink for solutions found by search engines
+     *
+     * If a sink is passed as option to a search engine, the engine
+     * passes all solutions to the sink rather than returning them:
+     * the next() operation of the engine then runs until search is
+     * complete or has been stopped and returns NULL.
+     *
+     * Parallel engines for depth-first and branch-and-bound search
+     * pass a solution to the sink as soon as a worker finds it while
+     * the other workers continue searching. The sink is never called
+     * concurrently, and the worker calling the sink continues only
+     * after solution() has returned: a sink that buffers solutions
+     * can bound its buffer by blocking. Branch-and-bound search
+     * passes solutions in the order of improvement: a solution for
+     * which a better one has already been passed is skipped.
+     *
+     * The space passed to the sink is deleted after solution() has
+     * returned. Hence, a sink should copy out the information it
+     * needs (for example, the values of the variables) rather than
+     * cloning the space.
+     *
+     * \ingroup TaskModelSearch
+     */
+    class Sink {
+    public:
+      /// Receive solution \a s
+      virtual void solution(const Space& s) = 0;
+      /// Destructor
+      virtual ~Sink(void) {}
+    };
+
+    /**
+     * \brief Search engines available as assets of a portfolio
+     * \ingroup TaskModelSearch
+     */
+    enum AssetEngine {
+      AE_DFS,     ///< Depth-first search
+      AE_LDS,     ///< Limited discrepancy search
+      AE_BAB,     ///< Branch-and-bound search
+      AE_RESTART, ///< Restart best solution search
+      AE_RBS      ///< Restart-based search
+    };
+
+    /**
+     * \brief Asset of a portfolio
+     *
+     * An asset defines which search engine \a engine with which
+     * options \a opt is run by a portfolio. If \a space is not NULL,
+     * the asset searches \a space (for example, a space using a
+     * differently seeded branching) instead of a clone of the root
+     * space of the portfolio. The space \a space must be of the same
+     * type as the root space, it is cloned and remains owned by the
+     * caller.
+     *
+     * \ingroup TaskModelSearch
+     */
+    class Asset {
+    public:
+      /// Search engine used by the asset
+      AssetEngine engine;
+      /// Options for the search engine (the stop-object is ignored)
+      Options opt;
+      /// Space to be searched (NULL for a clone of the root space)
+      Space* space;
+      /// Default initialization
+      Asset(void);
+      /// Initialize with engine \a e, options \a o, and space \a s
+      Asset(AssetEngine e, const Options& o=Options::def, Space* s=NULL);
+    };
+
     /// %Sequential search engine implementations
     namespace Sequential {}
 
     /// %Parallel search engine implementations
     namespace Parallel {}
 
+    /// Meta search engine implementations
+    namespace Meta {}
   }
 
 }
 
+#include <gecode/search/exception.hpp>
 #include <gecode/search/statistics.hpp>
 #include <gecode/search/stop.hpp>
+#include <gecode/search/cutoff.hpp>
 #include <gecode/search/options.hpp>
 
 namespace Gecode {
@@ -358,6 +622,49 @@ namespace Gecode {
 
 
 
+  /**
+   * \brief Limited discrepancy search engine
+   *
+   * This class supports limited discrepancy search for subclasses
+   * \a T of Space. The search tree is explored by a sequence of probes
+   * with increasing discrepancy limit, starting with zero and ending
+   * with the limit \a d_l defined by the search options. Following
+   * the \f$i\f$-th alternative of a choice counts as \f$i\f$
+   * discrepancies. Each solution is returned exactly once.
+   *
+   * Limited discrepancy search is well suited for problems where
+   * the value selection heuristic is good: solutions that follow
+   * the heuristic in all but few choices are found first.
+   *
+   * The engine only supports sequential search and ignores the
+   * number of threads.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class LDS {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize search engine for space \a s with options \a o
+    LDS(T* s, const Search::Options& o=Search::Options::def);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~LDS(void);
+  };
+
+  /// Invoke limited discrepancy search engine for subclass \a T of space \a s with options \a o
+  template<class T>
+  T* lds(T* s, const Search::Options& o=Search::Options::def);
+
+
+
   /**
    * \brief Depth-first branch-and-bound search engine
    *
@@ -447,11 +754,136 @@ namespace Gecode {
   template<class T>
   T* restart(T* s, const Search::Options& o=Search::Options::def);
 
+
+
+  /**
+   * \brief Restart-based search engine
+   *
+   * Performs depth-first search that is restarted from the root
+   * whenever the number of failures since the last restart exceeds
+   * the next value of the cutoff sequence defined by the option
+   * \a cutoff (see Search::Cutoff). If no cutoff sequence is given,
+   * search is only restarted after a solution has been found.
+   *
+   * As all restarts are performed on clones of the root space,
+   * accumulated failure counts and activities are kept across restarts,
+   * so that heuristics based on them explore a different tree after
+   * each restart.
+   *
+   * Like for the Restart engine, each solution found is
+   * better than the previous one: additionally, \a s must implement
+   * a member function
+   * \code virtual void constrain(const T& t) \endcode
+   * Whenever a solution has been found and search continues, the
+   * engine executes \c r.constrain(t) for the root space \a r
+   * where \a t is the so-far best solution.
+   *
+   * The number of failures, nodes, and propagations reported by the
+   * statistics (also to a stop object) include all restarts.
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class RBS {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize engine for space \a s and options \a o
+    RBS(T* s, const Search::Options& o=Search::Options::def);
+    /// Return next better solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~RBS(void);
+  };
+
+  /**
+   * \brief Perform restart-based search for subclass \a T of space \a s and options \a o
+   *
+   * Returns the first solution found (if any).
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  T* rbs(T* s, const Search::Options& o=Search::Options::def);
+
+
+
+  /**
+   * \brief Portfolio search engine
+   *
+   * Runs the \a n assets \a a (see Search::Asset) in parallel, each
+   * in its own thread and on its own clone of the root space (or
+   * on the space provided by the asset). The assets can differ in
+   * the search engine used as well as in their options (for example,
+   * different cutoff sequences for restart-based search).
+   *
+   * If no asset performs best solution search, the portfolio returns
+   * the first solution found by any asset and search is finished
+   * afterwards. Otherwise, each solution returned is better than
+   * the previous one and the so-far best solution is shared among
+   * all assets: as soon as an asset finds a better solution, all
+   * other assets are constrained to find only better solutions.
+   * Then, \a T must implement a member function
+   * \code virtual void constrain(const T& t) \endcode
+   * Search is complete as soon as the search of one asset using a
+   * complete search engine is exhausted. Limited discrepancy search
+   * is incomplete (it only explores the search tree up to its
+   * discrepancy limit): an asset using it is retired when its search
+   * is exhausted while the other assets continue. If all assets have
+   * been retired, search is complete as well.
+   *
+   * The stop-object of the options \a o is checked by each asset
+   * individually (with the statistics of the asset), the
+   * stop-objects of the assets are ignored. The statistics
+   * returned by the portfolio are the sum of the statistics of all
+   * assets.
+   *
+   * If threads are not available, only the first asset is run.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class PBS {
+  private:
+    /// The actual search engine
+    Search::Engine* e;
+  public:
+    /// Initialize engine for space \a s, \a n assets \a a, and options \a o
+    PBS(T* s, const Search::Asset* a, unsigned int n,
+        const Search::Options& o=Search::Options::def);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+    /// Destructor
+    ~PBS(void);
+  };
+
+  /**
+   * \brief Perform portfolio search for subclass \a T of space \a s, \a n assets \a a, and options \a o
+   *
+   * Returns the first solution found (if any).
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  T* pbs(T* s, const Search::Asset* a, unsigned int n,
+         const Search::Options& o=Search::Options::def);
+
 }
 
 #include <gecode/search/dfs.hpp>
+#include <gecode/search/lds.hpp>
 #include <gecode/search/bab.hpp>
 #include <gecode/search/restart.hpp>
+#include <gecode/search/rbs.hpp>
+#include <gecode/search/pbs.hpp>
 
 #endif
 
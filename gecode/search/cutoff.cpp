@@ -0,0 +1,96 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <climits>
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Constant cutoff
+   *
+   */
+  unsigned long int
+  CutoffConstant::operator ()(void) {
+    return c;
+  }
+
+
+  /*
+   * Luby cutoff
+   *
+   */
+  unsigned long int
+  CutoffLuby::luby(unsigned long int i) {
+    while (true) {
+      // Find smallest k such that 2^k - 1 >= i
+      unsigned long int k = 1;
+      while (((1UL << k) - 1) < i)
+        k++;
+      if (i == (1UL << k) - 1)
+        return 1UL << (k-1);
+      // Element i is the same as element i - 2^(k-1) + 1
+      i -= (1UL << (k-1)) - 1;
+    }
+    GECODE_NEVER;
+    return 0;
+  }
+
+  unsigned long int
+  CutoffLuby::operator ()(void) {
+    return s * luby(i++);
+  }
+
+
+  /*
+   * Geometric cutoff
+   *
+   */
+  unsigned long int
+  CutoffGeometric::operator ()(void) {
+    // Values beyond the range of unsigned long int are clamped
+    if (n >= static_cast<double>(ULONG_MAX))
+      return ULONG_MAX;
+    unsigned long int c = static_cast<unsigned long int>(n);
+    n *= b;
+    return c;
+  }
+
+}}
+
+// STATISTICS: search-other
@@ -49,11 +49,11 @@ namespace Gecode { namespace Search {
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
     if (to.threads == 1.0)
-      return new WorkerToEngine<Sequential::DFS>(s,sz,to);
+      return sink(new WorkerToEngine<Sequential::DFS>(s,sz,to),to);
     else
       return new Parallel::DFS(s,sz,to);
 #else
-    return new WorkerToEngine<Sequential::DFS>(s,sz,o);
+    return sink(new WorkerToEngine<Sequential::DFS>(s,sz,o),o);
 #endif
   }
 
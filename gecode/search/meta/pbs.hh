@@ -0,0 +1,197 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_META_PBS_HH__
+#define __GECODE_SEARCH_META_PBS_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  class PBS;
+
+  /**
+   * \brief Stop-object for assets of a portfolio
+   *
+   * Stops the engine of an asset if either the portfolio requests all
+   * assets to pause, if a better solution has been found by another
+   * asset, or if the stop-object \a so provided by the user (if any)
+   * reports to stop.
+   */
+  class PortfolioStop : public Stop {
+  private:
+    /// The portfolio
+    PBS& p;
+    /// Stop-object used by the user (might be NULL)
+    Stop* so;
+    /// Whether the user stop-object has stopped search
+    bool u_stopped;
+  public:
+    /// Version of the best solution the asset has been constrained with
+    unsigned long int v;
+    /// Initialize for portfolio \a p with user stop-object \a s
+    PortfolioStop(PBS& p, Stop* s);
+    /// Whether the user stop-object has stopped search
+    bool userstopped(void) const;
+    /// Reset stop information
+    void start(void);
+    /// Return true if search must be stopped
+    virtual bool stop(const Statistics& s, const Options& o);
+  };
+
+  /// Portfolio search engine implementation
+  class PBS : public Engine {
+    friend class PortfolioStop;
+  public:
+    class Slave;
+    friend class Slave;
+    /// Asset running a search engine in its own thread
+    class Slave : public Support::Runnable {
+    public:
+      /// The portfolio
+      PBS& p;
+      /// The search engine of the asset
+      Engine* e;
+      /// The stop-object of the asset
+      PortfolioStop stop;
+      /// Event for resuming search
+      Support::Event e_resume;
+      /// Whether the search engine of the asset is complete
+      bool complete;
+      /// Whether the asset has been retired
+      bool retired;
+      /// Initialize for portfolio \a p
+      Slave(PBS& p, Stop* so);
+      /// Run the asset
+      virtual void run(void);
+    };
+  protected:
+    /// Number of assets
+    unsigned int n;
+    /// Number of assets not yet retired
+    unsigned int n_active;
+    /// The assets
+    Slave** slaves;
+    /// Whether the portfolio performs best solution search
+    bool bs;
+    /// Mutex for access to the portfolio
+    Support::Mutex m;
+    /// Event for a finished round of search
+    Support::Event e_done;
+    /// Number of assets still busy in the current round
+    unsigned int n_busy;
+    /// Whether all assets must pause
+    volatile bool pause;
+    /// Version of best solution (incremented for each better solution)
+    volatile unsigned long int version;
+    /// Best solution found so far (only for best solution search)
+    Space* best;
+    /// Solution found in the current round (NULL if none)
+    Space* sol;
+    /// Whether search is complete
+    bool done;
+    /// Whether search has been stopped by a user stop-object
+    bool has_stopped;
+    /// Whether the assets must terminate
+    bool terminate;
+  public:
+    /// \name Communication between assets and portfolio
+    //@{
+    /// Report solution \a s found by slave \a a and return whether to pause
+    bool solution(Slave& a, Space* s);
+    /// Report that a slave has been stopped by the user stop-object
+    void userstop(void);
+    /// Report that the search of a slave is complete
+    void complete(void);
+    /// Report that the incomplete search of slave \a a is exhausted
+    void retire(Slave& a);
+    /// Report that a slave finished the current round
+    void ack(void);
+    /// Constrain engine of slave \a a by the so-far best solution
+    void sync(Slave& a);
+    //@}
+    /// \name Engine interface
+    //@{
+    /// Initialize for space \a s (of size \a sz), assets \a a, and options \a o
+    PBS(Space* s, size_t sz, const Asset* a, unsigned int n, 
+        const Options& o);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~PBS(void);
+    //@}
+  };
+
+
+  /*
+   * Stop-object for assets
+   *
+   */
+  forceinline
+  PortfolioStop::PortfolioStop(PBS& p0, Stop* s)
+    : p(p0), so(s), u_stopped(false), v(0) {}
+
+  forceinline bool
+  PortfolioStop::userstopped(void) const {
+    return u_stopped;
+  }
+
+  forceinline void
+  PortfolioStop::start(void) {
+    u_stopped = false;
+  }
+
+  forceinline bool
+  PortfolioStop::stop(const Statistics& s, const Options& o) {
+    if (p.pause || (p.version != v))
+      return true;
+    if ((so != NULL) && so->stop(s,o)) {
+      u_stopped = true;
+      return true;
+    }
+    return false;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
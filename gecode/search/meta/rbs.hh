@@ -0,0 +1,170 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_META_RBS_HH__
+#define __GECODE_SEARCH_META_RBS_HH__
+
+#include <climits>
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  /**
+   * \brief Stop-object for restart-based search
+   *
+   * Stops the engine for the current restart if either the stop-object
+   * \a so provided by the user (if any) reports to stop or if the number
+   * of failures of the current restart exceeds the cutoff. The
+   * user stop-object is passed the statistics accumulated over all
+   * restarts.
+   */
+  class RestartStop : public Stop {
+  private:
+    /// Stop-object used by the user (might be NULL)
+    Stop* so;
+    /// Stop-object for the cutoff
+    FailStop fs;
+    /// Statistics accumulated over all previous restarts
+    Statistics m;
+    /// Whether the user stop-object has stopped search
+    bool e_stopped;
+  public:
+    /// Initialize with user stop-object \a s
+    RestartStop(Stop* s);
+    /// Reset stop information
+    void start(void);
+    /// Set failure limit for next restart to \a l
+    void limit(unsigned long int l);
+    /// Accumulate statistics \a s of a finished restart
+    void update(const Statistics& s);
+    /// Whether the user stop-object has stopped search
+    bool enginestopped(void) const;
+    /// Return statistics accumulated over all previous restarts
+    Statistics metastatistics(void) const;
+    /// Return true if search must be stopped
+    virtual bool stop(const Statistics& s, const Options& o);
+  };
+
+  /// Restart-based search engine implementation
+  class RBS : public Engine {
+  protected:
+    /// Stop-object controlling restarts
+    RestartStop rs;
+    /// Options for engines performing the restarts
+    Options opt;
+    /// Size of space
+    size_t sz;
+    /// Root node (NULL if failed)
+    Space* root;
+    /// So-far best solution
+    Space* best;
+    /// Engine for the current restart
+    Engine* e;
+    /// Create new engine for space \a s
+    void engine(Space* s);
+  public:
+    /// Initialize engine for space \a s (with size \a sz) and options \a o
+    RBS(Space* s, size_t sz, const Options& o);
+    /// Return next better solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~RBS(void);
+  };
+
+
+  /*
+   * Stop-object for restarts
+   *
+   */
+  forceinline
+  RestartStop::RestartStop(Stop* s)
+    : so(s), fs(ULONG_MAX), e_stopped(false) {}
+
+  forceinline void
+  RestartStop::start(void) {
+    e_stopped = false;
+  }
+
+  forceinline void
+  RestartStop::limit(unsigned long int l) {
+    fs.limit(l);
+  }
+
+  forceinline void
+  RestartStop::update(const Statistics& s) {
+    size_t mem = std::max(m.memory,s.memory);
+    m += s;
+    m.memory = mem;
+  }
+
+  forceinline bool
+  RestartStop::enginestopped(void) const {
+    return e_stopped;
+  }
+
+  forceinline Statistics
+  RestartStop::metastatistics(void) const {
+    return m;
+  }
+
+  forceinline bool
+  RestartStop::stop(const Statistics& s, const Options& o) {
+    if (so != NULL) {
+      // Check user stop-object with accumulated statistics
+      Statistics t(m);
+      t += s;
+      t.memory = s.memory;
+      if (so->stop(t,o)) {
+        e_stopped = true;
+        return true;
+      }
+    }
+    return fs.stop(s,o);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
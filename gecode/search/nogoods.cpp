@@ -0,0 +1,148 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include <gecode/search/nogoods.hh>
+
+namespace Gecode { namespace Search {
+
+  forceinline
+  NoGoodsProp::NoGoodsProp(Space& home, NGL* r)
+    : Propagator(home), root(r) {
+    root->subscribe(home,*this);
+  }
+
+  forceinline
+  NoGoodsProp::NoGoodsProp(Space& home, bool share, NoGoodsProp& p)
+    : Propagator(home,share,p), root(NULL) {
+    NGL* c = NULL;
+    for (NGL* l = p.root; l != NULL; l = l->next()) {
+      NGL* d = l->copy(home,share);
+      if (c == NULL)
+        root = d;
+      else
+        c->next(d);
+      c = d;
+    }
+  }
+
+  void
+  NoGoodsProp::dispose(Space& home, NGL* l) {
+    while (l != NULL) {
+      NGL* n = l->next();
+      home.rfree(l,l->dispose(home));
+      l = n;
+    }
+  }
+
+  ExecStatus
+  NoGoodsProp::prune(Space& home, NGL*& l) {
+    while (l != NULL) {
+      if (l->leaf()) {
+        GECODE_ES_CHECK(l->prune(home));
+      } else {
+        switch (l->status(home)) {
+        case NGL::FAILED:
+          // All remaining no-goods are entailed
+          dispose(home,l); l = NULL;
+          return ES_OK;
+        case NGL::NONE:
+          return ES_OK;
+        case NGL::SUBSUMED:
+          break;
+        default: GECODE_NEVER;
+        }
+      }
+      NGL* n = l->next();
+      home.rfree(l,l->dispose(home));
+      l = n;
+    }
+    return ES_OK;
+  }
+
+  Actor*
+  NoGoodsProp::copy(Space& home, bool share) {
+    return new (home) NoGoodsProp(home,share,*this);
+  }
+
+  PropCost
+  NoGoodsProp::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,1);
+  }
+
+  ExecStatus
+  NoGoodsProp::propagate(Space& home, const ModEventDelta&) {
+    switch (root->status(home)) {
+    case NGL::FAILED:
+      return home.ES_SUBSUMED(*this);
+    case NGL::NONE:
+      return ES_FIX;
+    case NGL::SUBSUMED:
+      break;
+    default: GECODE_NEVER;
+    }
+    NGL* l = root;
+    root->cancel(home,*this);
+    root = NULL;
+    GECODE_ES_CHECK(prune(home,l));
+    if (l == NULL)
+      return home.ES_SUBSUMED(*this);
+    root = l;
+    root->subscribe(home,*this);
+    return ES_FIX;
+  }
+
+  ExecStatus
+  NoGoodsProp::post(Space& home, NGL* l) {
+    GECODE_ES_CHECK(prune(home,l));
+    if (l != NULL)
+      (void) new (home) NoGoodsProp(home,l);
+    return ES_OK;
+  }
+
+  size_t
+  NoGoodsProp::dispose(Space& home) {
+    if (root != NULL) {
+      root->cancel(home,*this);
+      dispose(home,root);
+      root = NULL;
+    }
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}
+
+// STATISTICS: search-other
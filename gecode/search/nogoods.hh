@@ -0,0 +1,93 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#ifndef __GECODE_SEARCH_NOGOODS_HH__
+#define __GECODE_SEARCH_NOGOODS_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Propagator for no-goods recorded from a search path
+   *
+   * The propagator maintains a list of no-good literals (see NGL) as
+   * created from the edges of a search path: each non-leaf literal
+   * corresponds to a decision on the path, each leaf literal to an
+   * alternative that has been explored completely. A leaf literal
+   * must be pruned as soon as all decisions preceding it hold.
+   *
+   * The propagator is only subscribed to the first literal of the
+   * list which is always a decision that is neither subsumed nor
+   * failed.
+   */
+  class NoGoodsProp : public Propagator {
+  protected:
+    /// First literal of the list (watched), NULL if none
+    NGL* root;
+    /// Constructor for creation
+    NoGoodsProp(Space& home, NGL* root);
+    /// Constructor for cloning \a p
+    NoGoodsProp(Space& home, bool share, NoGoodsProp& p);
+    /**
+     * \brief Run along the literals starting at \a l
+     *
+     * Prunes all leaf literals and skips all subsumed decisions
+     * (the literals are freed). On return, \a l is either NULL (all
+     * no-goods are entailed) or the first decision that is neither
+     * subsumed nor failed.
+     */
+    static ExecStatus prune(Space& home, NGL*& l);
+  public:
+    /// Free all literals starting at \a l
+    static void dispose(Space& home, NGL* l);
+    /// Perform copying during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Const function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for no-good literals starting at \a l
+    static ExecStatus post(Space& home, NGL* l);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+}}
+
+#endif
+
+// STATISTICS: search-other
@@ -41,8 +41,9 @@ namespace Gecode { namespace Search {
   Options::Options(void)
     : clone(Config::clone), 
       threads(Config::threads), 
-      c_d(Config::c_d), a_d(Config::a_d), 
-      stop(NULL) {}
+      c_d(Config::c_d), a_d(Config::a_d), d_l(Config::d_l),
+      pin(Config::pin), locality(Config::locality),
+      stop(NULL), cutoff(NULL), nogoods_limit(0), memory_limit(0), sink(NULL), profile(NULL) {}
 
 }}
 
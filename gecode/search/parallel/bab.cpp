@@ -54,14 +54,48 @@ namespace Gecode { namespace Search { namespace Parallel {
     return s;
   }
 
+
+  /*
+   * Idle workers
+   */
+  bool
+  BAB::work(void) const {
+    for (unsigned int i=0; i<workers(); i++)
+      if (worker(i)->work())
+        return true;
+    return false;
+  }
+
+
+  /*
+   * Search control
+   */
+  void
+  BAB::constrain(const Space& b) {
+    m_best.acquire();
+    Space* s = b.clone(false);
+    if (best != NULL) {
+      // Check whether b is in fact better
+      s->constrain(*best);
+      if (s->status() == SS_FAILED) {
+        delete s;
+        m_best.release();
+        return;
+      }
+      delete best;
+    }
+    best = s;
+    b_version++;
+    m_best.release();
+  }
+
   /*
    * Actual work
    */
   void
   BAB::Worker::run(void) {
-    // Peform initial delay, if not first worker
-    if (this != engine().worker(0))
-      Support::Thread::sleep(Config::initial_delay);
+    // Bind to processing unit, if requested
+    bind();
     // Okay, we are in business, start working
     while (true) {
       switch (engine().cmd()) {
@@ -74,6 +108,8 @@ namespace Gecode { namespace Search { namespace Parallel {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        // Release processing unit as thread might be reused
+        unbind();
         // Terminate thread
         engine().terminated();
         return;
@@ -81,6 +117,8 @@ namespace Gecode { namespace Search { namespace Parallel {
         // Perform exploration work
         {
           m.acquire();
+          // Take better solution found by other workers right away
+          better();
           if (idle) {
             m.release();
             // Try to find new work
@@ -111,7 +149,7 @@ namespace Gecode { namespace Search { namespace Parallel {
                 {
                   // Deletes all pending branchers
                   (void) cur->choice();
-                  Space* s = cur->clone(false);
+                  Space* s = cur->clone(false,*this);
                   delete cur;
                   cur = NULL;
                   Worker::current(NULL);
@@ -122,8 +160,8 @@ namespace Gecode { namespace Search { namespace Parallel {
               case SS_BRANCH:
                 {
                   Space* c;
-                  if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                  if (path.clone(d,c_d(engine().opt(),path.entries()))) {
+                    c = cur->clone(true,*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -132,6 +170,9 @@ namespace Gecode { namespace Search { namespace Parallel {
                   const Choice* ch = path.push(*this,cur,c);
                   Worker::push(c,ch);
                   cur->commit(*ch,0);
+                  // Wake up an idle worker if there is work to steal
+                  if (path.steal())
+                    engine().wakeup();
                   m.release();
                 }
                 break;
@@ -140,7 +181,7 @@ namespace Gecode { namespace Search { namespace Parallel {
               }
             }
           } else if (path.next(*this)) {
-            cur = path.recompute(d,engine().opt().a_d,*this,best,mark);
+            cur = path.recompute(d,a_d(engine().opt()),*this,best,mark);
             Worker::current(cur);
             m.release();
           } else {
@@ -52,15 +52,17 @@ namespace Gecode { namespace Search { namespace Parallel {
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Version of the best solution known to the worker
+      unsigned int v;
     public:
-      /// Initialize for space \a s (of size \a sz) with engine \a e
-      Worker(Space* s, size_t sz, BAB& e);
+      /// Initialize worker \a i for space \a s (of size \a sz) with engine \a e
+      Worker(Space* s, size_t sz, unsigned int i, BAB& e);
       /// Provide access to engine
       BAB& engine(void) const;
       /// Start execution of worker
       virtual void run(void);
-      /// Accept better solution \a b
-      void better(Space* b);
+      /// Accept better solution from engine if available
+      void better(void);
       /// Try to find some work
       void find(void);
       /// Destructor
@@ -68,16 +70,31 @@ namespace Gecode { namespace Search { namespace Parallel {
     };
     /// Array of worker references
     Worker** _worker;
+    /// \name Channel for best solution
+    //@{
+    /// Mutex for access to best solution
+    Support::Mutex m_best;
     /// Best solution so far
     Space* best;
+    /// Version of best solution (incremented for each better solution)
+    volatile unsigned int b_version;
+    /// Version of the last solution passed to the sink (protected by m_sink)
+    unsigned int s_version;
+    //@}
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
+    /// Make a quick check whether any worker has work to be stolen
+    virtual bool work(void) const;
 
     /// \name Search control
     //@{
     /// Report solution \a s
     void solution(Space* s);
+    /// Return version of best solution
+    unsigned int version(void) const;
+    /// Return copy of best solution if newer than version \a v (update \a v)
+    Space* better(unsigned int& v);
     //@}
 
     /// \name Engine interface
@@ -86,6 +103,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     BAB(Space* s, size_t sz, const Options& o);
     /// Return statistics
     virtual Statistics statistics(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
     /// Destructor
     virtual ~BAB(void);
     //@}
@@ -110,20 +129,20 @@ namespace Gecode { namespace Search { namespace Parallel {
    * Engine: initialization
    */
   forceinline
-  BAB::Worker::Worker(Space* s, size_t sz, BAB& e)
-    : Engine::Worker(s,sz,e), mark(0), best(NULL) {}
+  BAB::Worker::Worker(Space* s, size_t sz, unsigned int i, BAB& e)
+    : Engine::Worker(s,sz,i,e), mark(0), best(NULL), v(0) {}
 
   forceinline
   BAB::BAB(Space* s, size_t sz, const Options& o)
-    : Engine(o), best(NULL) {
+    : Engine(o), best(NULL), b_version(0), s_version(0) {
     // Create workers
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
     // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,sz,*this);
+    _worker[0] = new Worker(s,sz,0,*this);
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
-      _worker[i] = new Worker(NULL,sz,*this);
+      _worker[i] = new Worker(NULL,sz,i,*this);
     // Block all workers
     block();
     // Create and start threads
@@ -135,40 +154,74 @@ namespace Gecode { namespace Search { namespace Parallel {
   /*
    * Engine: search control
    */
+  forceinline unsigned int
+  BAB::version(void) const {
+    return b_version;
+  }
+  forceinline Space*
+  BAB::better(unsigned int& v) {
+    Space* b = NULL;
+    m_best.acquire();
+    if (v != b_version) {
+      // Cloning might modify best, hence it must be done under the lock
+      b = best->clone(false);
+      v = b_version;
+    }
+    m_best.release();
+    return b;
+  }
   forceinline void
-  BAB::Worker::better(Space* b) {
-    m.acquire();
-    delete best;
-    best = b->clone(false);
-    mark = path.entries();
-    if (cur != NULL)
-      cur->constrain(*best);
-    m.release();
+  BAB::Worker::better(void) {
+    /*
+     * Polling the version without locking is cheap: if it is stale,
+     * the better solution is just taken at the next node.
+     */
+    if (v == engine().version())
+      return;
+    if (Space* b = engine().better(v)) {
+      delete best;
+      best = b;
+      mark = path.entries();
+      if (cur != NULL)
+        cur->constrain(*best);
+    }
   }
   forceinline void 
   BAB::solution(Space* s) {
-    m_search.acquire();
+    m_best.acquire();
     if (best != NULL) {
       s->constrain(*best);
       if (s->status() == SS_FAILED) {
         delete s;
-        m_search.release();
+        m_best.release();
         return;
-      } else {
-        delete best;
-        best = s->clone();
       }
+      delete best;
+    }
+    best = s->clone();
+    // Publish better solution, workers poll the version at each node
+    unsigned int v = ++b_version;
+    if (opt().sink != NULL) {
+      m_best.release();
+      // Pass solution to sink while the other workers continue
+      m_sink.acquire();
+      // Skip the solution if a better one has been passed meanwhile
+      if (v > s_version) {
+        s_version = v;
+        opt().sink->solution(*s);
+      }
+      m_sink.release();
+      delete s;
     } else {
-      best = s->clone();
+      // Solutions are queued in order as the lock is held
+      m_search.acquire();
+      bool bs = signal();
+      solutions.push(s);
+      if (bs)
+        e_search.signal();
+      m_search.release();
+      m_best.release();
     }
-    // Announce better solutions
-    for (unsigned int i=0; i<workers(); i++)
-      worker(i)->better(best);
-    bool bs = signal();
-    solutions.push(s);
-    if (bs)
-      e_search.signal();
-    m_search.release();
   }
   
 
@@ -178,9 +231,9 @@ namespace Gecode { namespace Search { namespace Parallel {
   forceinline void
   BAB::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
+    for (Victims v(*this); v(); ++v) {
       unsigned long int r_d;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      if (Space* s = engine().worker(v.val())->steal(r_d)) {
         // Reset this guy
         m.acquire();
         idle = false;
@@ -194,6 +247,8 @@ namespace Gecode { namespace Search { namespace Parallel {
         return;
       }
     }
+    // No work available, sleep until some other worker has work
+    engine().sleep(*this);
   }
 
 }}}
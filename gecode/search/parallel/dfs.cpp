@@ -55,14 +55,25 @@ namespace Gecode { namespace Search { namespace Parallel {
   }
 
 
+  /*
+   * Idle workers
+   */
+  bool
+  DFS::work(void) const {
+    for (unsigned int i=0; i<workers(); i++)
+      if (worker(i)->work())
+        return true;
+    return false;
+  }
+
+
   /*
    * Engine: search control
    */
   void
   DFS::Worker::run(void) {
-    // Peform initial delay, if not first worker
-    if (this != engine().worker(0))
-      Support::Thread::sleep(Config::initial_delay);
+    // Bind to processing unit, if requested
+    bind();
     // Okay, we are in business, start working
     while (true) {
       switch (engine().cmd()) {
@@ -75,6 +86,8 @@ namespace Gecode { namespace Search { namespace Parallel {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        // Release processing unit as thread might be reused
+        unbind();
         // Terminate thread
         engine().terminated();
         return;
@@ -114,7 +127,7 @@ namespace Gecode { namespace Search { namespace Parallel {
                 {
                   // Deletes all pending branchers
                   (void) cur->choice();
-                  Space* s = cur->clone(false);
+                  Space* s = cur->clone(false,*this);
                   delete cur;
                   cur = NULL;
                   Worker::current(NULL);
@@ -125,8 +138,8 @@ namespace Gecode { namespace Search { namespace Parallel {
               case SS_BRANCH:
                 {
                   Space* c;
-                  if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                  if (path.clone(d,c_d(engine().opt(),path.entries()))) {
+                    c = cur->clone(true,*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -135,6 +148,9 @@ namespace Gecode { namespace Search { namespace Parallel {
                   const Choice* ch = path.push(*this,cur,c);
                   Worker::push(c,ch);
                   cur->commit(*ch,0);
+                  // Wake up an idle worker if there is work to steal
+                  if (path.steal())
+                    engine().wakeup();
                   m.release();
                 }
                 break;
@@ -143,7 +159,7 @@ namespace Gecode { namespace Search { namespace Parallel {
               }
             }
           } else if (path.next(*this)) {
-            cur = path.recompute(d,engine().opt().a_d,*this);
+            cur = path.recompute(d,a_d(engine().opt()),*this);
             Worker::current(cur);
             m.release();
           } else {
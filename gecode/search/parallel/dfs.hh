@@ -48,8 +48,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     /// %Parallel depth-first search worker
     class Worker : public Engine::Worker {
     public:
-      /// Initialize for space \a s (of size \a sz) with engine \a e
-      Worker(Space* s, size_t sz, DFS& e);
+      /// Initialize worker \a i for space \a s (of size \a sz) with engine \a e
+      Worker(Space* s, size_t sz, unsigned int i, DFS& e);
       /// Provide access to engine
       DFS& engine(void) const;
       /// Start execution of worker
@@ -64,6 +64,8 @@ namespace Gecode { namespace Search { namespace Parallel {
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
+    /// Make a quick check whether any worker has work to be stolen
+    virtual bool work(void) const;
 
     /// \name Search control
     //@{
@@ -102,8 +104,8 @@ namespace Gecode { namespace Search { namespace Parallel {
    * Engine: initialization
    */
   forceinline
-  DFS::Worker::Worker(Space* s, size_t sz, DFS& e)
-    : Engine::Worker(s,sz,e) {}
+  DFS::Worker::Worker(Space* s, size_t sz, unsigned int i, DFS& e)
+    : Engine::Worker(s,sz,i,e) {}
   forceinline
   DFS::DFS(Space* s, size_t sz, const Options& o)
     : Engine(o) {
@@ -111,10 +113,10 @@ namespace Gecode { namespace Search { namespace Parallel {
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
     // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,sz,*this);
+    _worker[0] = new Worker(s,sz,0,*this);
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
-      _worker[i] = new Worker(NULL,sz,*this);
+      _worker[i] = new Worker(NULL,sz,i,*this);
     // Block all workers
     block();
     // Create and start threads
@@ -156,6 +158,14 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline void 
   DFS::solution(Space* s) {
+    if (opt().sink != NULL) {
+      // Pass solution to sink while the other workers continue
+      m_sink.acquire();
+      opt().sink->solution(*s);
+      m_sink.release();
+      delete s;
+      return;
+    }
     m_search.acquire();
     bool bs = signal();
     solutions.push(s);
@@ -173,9 +183,9 @@ namespace Gecode { namespace Search { namespace Parallel {
   forceinline void
   DFS::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
+    for (Victims v(*this); v(); ++v) {
       unsigned long int r_d;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      if (Space* s = engine().worker(v.val())->steal(r_d)) {
         // Reset this guy
         m.acquire();
         idle = false;
@@ -186,6 +196,8 @@ namespace Gecode { namespace Search { namespace Parallel {
         return;
       }
     }
+    // No work available, sleep until some other worker has work
+    engine().sleep(*this);
   }
 
 }}}
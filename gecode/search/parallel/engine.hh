@@ -53,6 +53,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     protected:
       /// Reference to engine
       Engine& _engine;
+      /// Index of worker in engine
+      unsigned int _index;
       /// Mutex for access to worker
       Support::Mutex m;
       /// Current path ins search tree
@@ -63,18 +65,73 @@ namespace Gecode { namespace Search { namespace Parallel {
       unsigned int d;
       /// Whether worker is currently idle
       bool idle;
+      /// Random number generator for selecting victims for stealing
+      Support::RandomGenerator rnd;
+      /// Event for waking up worker while being asleep
+      Support::Event e_sleep;
     public:
-      /// Initialize for space \a s (of size \a sz) with engine \a e
-      Worker(Space* s, size_t sz, Engine& e);
+      /// Initialize worker \a i for space \a s (of size \a sz) with engine \a e
+      Worker(Space* s, size_t sz, unsigned int i, Engine& e);
       /// Hand over some work (NULL if no work available)
       Space* steal(unsigned long int& d);
+      /// Make a quick check whether the worker has work to be stolen
+      bool work(void) const;
+      /// Return random number between 0 and \a n-1
+      unsigned int random(unsigned int n);
+      /// Wake up worker
+      void wakeup(void);
+      /// Put worker to sleep until woken up
+      void sleep(void);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
       Engine& engine(void) const;
+      /// Return index of worker in engine
+      unsigned int index(void) const;
+      /// Bind worker's thread to a processing unit, if requested
+      void bind(void);
+      /// Release binding of worker's thread, if requested
+      void unbind(void);
       /// Destructor
       virtual ~Worker(void);
     };
+    /**
+     * \brief Iterator over victims for stealing
+     *
+     * Iterates first over the workers in the same group as the
+     * thief and then over all other workers, both starting at a
+     * random worker. The thief itself is skipped.
+     */
+    class Victims {
+    protected:
+      /// Number of workers
+      unsigned int n;
+      /// Index of thief
+      unsigned int t;
+      /// First worker of thief's group
+      unsigned int g_f;
+      /// Number of workers in thief's group
+      unsigned int g_n;
+      /// Offset for iterating over group and all workers
+      unsigned int o;
+      /// Number of workers iterated (first in group, then all)
+      unsigned int i;
+      /// Current victim
+      unsigned int v;
+      /// Compute current victim
+      void move(void);
+      /// Whether current victim must be skipped
+      bool skip(void) const;
+    public:
+      /// Initialize for thief \a w
+      Victims(Worker& w);
+      /// Test whether there are victims left
+      bool operator ()(void) const;
+      /// Move to next victim
+      void operator ++(void);
+      /// Return index of current victim
+      unsigned int val(void) const;
+    };
     /// Search options
     const Options _opt;
   public:
@@ -82,6 +139,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     const Options& opt(void) const;
     /// Return number of workers
     unsigned int workers(void) const;
+    /// Make a quick check whether any worker has work to be stolen
+    virtual bool work(void) const = 0;
     
     /// \name Commands from engine to workers and wait management
     //@{
@@ -165,6 +224,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     Support::Event e_search;
     /// Queue of solutions
     Support::DynamicQueue<Space*,Heap> solutions;
+    /// Mutex for passing solutions to the sink
+    Support::Mutex m_sink;
     /// Number of busy workers
     volatile unsigned int n_busy;
     /// Whether a worker had been stopped
@@ -180,6 +241,24 @@ namespace Gecode { namespace Search { namespace Parallel {
     void stop(void);
     //@}
 
+    /// \name Control of idle workers
+    //@{
+  protected:
+    /// Mutex for access to sleeping workers
+    Support::Mutex m_sleep;
+    /// Number of sleeping workers
+    volatile unsigned int n_sleep;
+    /// Sleeping workers
+    Worker** sleeping;
+  public:
+    /// Let idle worker \a w sleep until work might be available
+    void sleep(Worker& w);
+    /// Wake up a sleeping worker (if any) as work is available
+    void wakeup(void);
+    /// Wake up all sleeping workers
+    void wakeup_all(void);
+    //@}
+
     /// \name Engine interface
     //@{
     /// Initialize with options \a o
@@ -188,6 +267,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     virtual Space* next(void);
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~Engine(void);
     //@}
   };
 
@@ -199,6 +280,10 @@ namespace Gecode { namespace Search { namespace Parallel {
   Engine::Worker::engine(void) const {
     return _engine;
   }
+  forceinline unsigned int
+  Engine::Worker::index(void) const {
+    return _index;
+  }
   forceinline const Options&
   Engine::opt(void) const {
     return _opt;
@@ -225,6 +310,8 @@ namespace Gecode { namespace Search { namespace Parallel {
   Engine::release(Cmd c) {
     _cmd = c;
     _m_wait.release();
+    // Sleeping workers must notice the new command
+    wakeup_all();
   }
   forceinline void 
   Engine::wait(void) {
@@ -236,8 +323,9 @@ namespace Gecode { namespace Search { namespace Parallel {
    * Engine: initialization
    */
   forceinline
-  Engine::Worker::Worker(Space* s, size_t sz, Engine& e)
-    : Search::Worker(sz), _engine(e), d(0), idle(false) {
+  Engine::Worker::Worker(Space* s, size_t sz, unsigned int i, Engine& e)
+    : Search::Worker(sz,e.opt().profile), _engine(e), _index(i), d(0),
+      idle(false), rnd(i+1) {
     if (s != NULL) {
       cur = (s->status(*this) == SS_FAILED) ? 
         NULL : snapshot(s,engine().opt());
@@ -262,6 +350,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     has_stopped = false;
     // Initialize reset information
     _n_reset_not_ack = workers();
+    // Initialize information for idle workers
+    n_sleep = 0;
+    sleeping = static_cast<Worker**>
+      (heap.ralloc(workers() * sizeof(Worker*)));
+  }
+  forceinline
+  Engine::~Engine(void) {
+    heap.rfree(sleeping);
   }
 
 
@@ -312,6 +408,63 @@ namespace Gecode { namespace Search { namespace Parallel {
   }
   
 
+  /*
+   * Engine: control of idle workers
+   */
+  forceinline void
+  Engine::Worker::wakeup(void) {
+    e_sleep.signal();
+  }
+  forceinline void
+  Engine::Worker::sleep(void) {
+    e_sleep.wait();
+  }
+  forceinline void
+  Engine::sleep(Worker& w) {
+    /*
+     * The worker is registered before it checks for work and for
+     * a changed command, all while holding the mutex. A worker that
+     * pushes work afterwards finds it registered and wakes it up
+     * (a signal before sleeping is not lost as the event remembers it).
+     */
+    m_sleep.acquire();
+    sleeping[n_sleep++] = &w;
+    Support::atomic_barrier();
+    if ((cmd() != C_WORK) || work()) {
+      // Still registered at the last position
+      n_sleep--;
+      m_sleep.release();
+      return;
+    }
+    m_sleep.release();
+    w.sleep();
+  }
+  forceinline void
+  Engine::wakeup(void) {
+#ifdef GECODE_HAS_ATOMICS
+    /*
+     * Quick check without locking: the barrier orders the check after
+     * pushing the work, so a worker registering concurrently either is
+     * seen here or sees the work itself.
+     */
+    Support::atomic_barrier();
+    if (n_sleep == 0)
+      return;
+#endif
+    m_sleep.acquire();
+    if (n_sleep > 0)
+      sleeping[--n_sleep]->wakeup();
+    m_sleep.release();
+  }
+  forceinline void
+  Engine::wakeup_all(void) {
+    m_sleep.acquire();
+    while (n_sleep > 0)
+      sleeping[--n_sleep]->wakeup();
+    m_sleep.release();
+  }
+
+
   /*
    * Engine: termination control
    */
@@ -400,12 +553,77 @@ namespace Gecode { namespace Search { namespace Parallel {
       return NULL;
     m.acquire();
     Space* s = path.steal(*this,d);
-    m.release();
-    // Tell that there will be one more busy worker
+    /*
+     * Tell that there will be one more busy worker. This must happen
+     * while the mutex is held: otherwise this worker might become idle
+     * before and the engine would wrongly assume that search is over.
+     */
     if (s != NULL) 
       engine().busy();
+    m.release();
     return s;
   }
+  forceinline bool
+  Engine::Worker::work(void) const {
+    return path.steal();
+  }
+  forceinline unsigned int
+  Engine::Worker::random(unsigned int n) {
+    return rnd(n);
+  }
+  forceinline void
+  Engine::Worker::bind(void) {
+    if (engine().opt().pin)
+      (void) Support::Thread::bind(index());
+  }
+  forceinline void
+  Engine::Worker::unbind(void) {
+    if (engine().opt().pin)
+      Support::Thread::unbind();
+  }
+
+  forceinline void
+  Engine::Victims::move(void) {
+    if (i < g_n)
+      v = g_f + (o + i) % g_n;
+    else
+      v = (o + i - g_n) % n;
+  }
+  forceinline bool
+  Engine::Victims::skip(void) const {
+    // Skip the thief and the workers of its group after the group
+    return (v == t) || ((i >= g_n) && (v >= g_f) && (v < g_f + g_n));
+  }
+  forceinline
+  Engine::Victims::Victims(Worker& w)
+    : n(w.engine().workers()), t(w.index()), i(0) {
+    unsigned int l = w.engine().opt().locality;
+    if ((l == 0) || (l >= n)) {
+      g_f = 0; g_n = n;
+    } else {
+      g_f = (t / l) * l; g_n = std::min(l, n - g_f);
+    }
+    o = w.random(n);
+    move();
+    if (skip())
+      ++(*this);
+  }
+  forceinline bool
+  Engine::Victims::operator ()(void) const {
+    return i < g_n + n;
+  }
+  forceinline void
+  Engine::Victims::operator ++(void) {
+    do {
+      if (++i >= g_n + n)
+        return;
+      move();
+    } while (skip());
+  }
+  forceinline unsigned int
+  Engine::Victims::val(void) const {
+    return v;
+  }
 
 }}}
 
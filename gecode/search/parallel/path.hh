@@ -38,6 +38,8 @@
 #ifndef __GECODE_SEARCH_PARALLEL_PATH_HH__
 #define __GECODE_SEARCH_PARALLEL_PATH_HH__
 
+#include <climits>
+
 #include <gecode/search.hh>
 
 namespace Gecode { namespace Search { namespace Parallel {
@@ -114,6 +116,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     bool empty(void) const;
     /// Return position on stack of last copy
     int lc(void) const;
+    /**
+     * \brief Test whether to clone at distance \a d for commit distance \a c_d
+     *
+     * A distance of zero requires a clone, unless the memory limit
+     * has been reached (\a c_d is UINT_MAX) and recomputation can
+     * start from a clone already on the stack.
+     */
+    bool clone(unsigned int d, unsigned int c_d) const;
     /// Unwind the stack up to position \a l (after failure)
     void unwind(int l);
     /// Commit space \a s as described by stack entry at position \a i
@@ -131,7 +141,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     void reset(void);
     /// Make a quick check whether stealing might be feasible
     bool steal(void) const;
-    /// Steal work at depth \a d
+    /// Steal work closest to the root (its depth is returned in \a d)
     Space* steal(Worker& stat, unsigned long int& d);
   };
 
@@ -252,6 +262,18 @@ namespace Gecode { namespace Search { namespace Parallel {
     return l;
   }
 
+  forceinline bool
+  Path::clone(unsigned int d, unsigned int c_d) const {
+    if (d > 0)
+      return d >= c_d;
+    if (c_d < UINT_MAX)
+      return true;
+    for (int l=ds.entries(); l--; )
+      if (ds[l].space() != NULL)
+        return false;
+    return true;
+  }
+
   forceinline int
   Path::entries(void) const {
     return ds.entries();
@@ -288,19 +310,22 @@ namespace Gecode { namespace Search { namespace Parallel {
 
   forceinline Space*
   Path::steal(Worker& stat, unsigned long int& d) {
-    // Find position to steal: leave sufficient work
-    int n = ds.entries()-1;
-    unsigned int w = 0;
-    while (n >= 0) {
-      if (ds[n].work())
-        w++;
-      if (w > Config::steal_limit) {
-        // Okay, there is sufficient work left
+    /*
+     * Find position to steal: take the alternative closest to the
+     * root as it is likely to have the largest subtree. This keeps
+     * the thief busy for longer and hence requires fewer steals.
+     */
+    if (!steal())
+      return NULL;
+    int n = 0;
+    int e = ds.entries();
+    while (n < e) {
+      if (ds[n].work()) {
         int l=n;
         // Find last copy
         while (ds[l].space() == NULL)
           l--;
-        Space* c = ds[l].space()->clone(false);
+        Space* c = ds[l].space()->clone(false,stat);
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
@@ -310,7 +335,7 @@ namespace Gecode { namespace Search { namespace Parallel {
         d = stat.steal_depth(static_cast<unsigned long int>(n+1));
         return c;
       }
-      n--;
+      n++;
     }
     return NULL;
   }
@@ -337,7 +362,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(true,stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -367,7 +392,7 @@ namespace Gecode { namespace Search { namespace Parallel {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
@@ -421,11 +446,11 @@ namespace Gecode { namespace Search { namespace Parallel {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(true,stat);
       ds[l].space(c);
       stat.constrained(s,c);
     } else {
-      s = s->clone();
+      s = s->clone(true,stat);
     }
 
     if (d < a_d) {
@@ -459,7 +484,7 @@ namespace Gecode { namespace Search { namespace Parallel {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
@@ -0,0 +1,327 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+#include <gecode/search/meta/pbs.hh>
+#include <gecode/search/support.hh>
+
+namespace Gecode { namespace Search {
+
+  namespace Meta {
+
+    /// Create engine \a ae for space \a s (of size \a sz) with options \a o
+    forceinline Engine*
+    engine(AssetEngine ae, Space* s, size_t sz, const Options& o) {
+      // Solutions of assets are collected by the portfolio
+      Options ao = nosink(o);
+      switch (ae) {
+      case AE_DFS:     return dfs(s,sz,ao);
+      case AE_LDS:     return lds(s,sz,ao);
+      case AE_BAB:     return bab(s,sz,ao);
+      case AE_RESTART: return restart(s,sz,ao);
+      case AE_RBS:     return rbs(s,sz,ao);
+      default: GECODE_NEVER;
+      }
+      return NULL;
+    }
+
+#ifdef GECODE_HAS_THREADS
+
+    /// Test whether engine \a ae performs best solution search
+    forceinline bool
+    bestengine(AssetEngine ae) {
+      return (ae == AE_BAB) || (ae == AE_RESTART) || (ae == AE_RBS);
+    }
+
+    /// Test whether engine \a ae explores the entire search tree
+    forceinline bool
+    completeengine(AssetEngine ae) {
+      return ae != AE_LDS;
+    }
+
+    /*
+     * Assets
+     *
+     */
+    PBS::Slave::Slave(PBS& p0, Stop* so)
+      : p(p0), e(NULL), stop(p0,so), complete(true), retired(false) {}
+
+    void
+    PBS::Slave::run(void) {
+      while (true) {
+        e_resume.wait();
+        if (p.terminate)
+          break;
+        stop.start();
+        p.sync(*this);
+        while (true) {
+          if (Space* s = e->next()) {
+            if (p.solution(*this,s))
+              break;
+          } else if (!e->stopped()) {
+            if (complete)
+              p.complete();
+            else
+              p.retire(*this);
+            break;
+          } else if (stop.userstopped()) {
+            p.userstop();
+            break;
+          } else if (p.pause) {
+            break;
+          } else {
+            // Another asset has found a better solution
+            p.sync(*this);
+          }
+        }
+        p.ack();
+      }
+      delete e;
+      p.ack();
+    }
+
+
+    /*
+     * Communication between assets and portfolio
+     *
+     */
+    bool
+    PBS::solution(Slave& a, Space* s) {
+      // Solutions are copied without sharing as they cross threads
+      m.acquire();
+      if (bs) {
+        if (best != NULL) {
+          s->constrain(*best);
+          if (s->status() == SS_FAILED) {
+            bool p = pause;
+            m.release();
+            delete s;
+            return p;
+          }
+          delete best;
+        }
+        best = s->clone(false);
+        version++;
+        a.stop.v = version;
+        delete sol;
+        sol = s->clone(false);
+      } else if (!done) {
+        // The first solution is the answer
+        sol = s->clone(false);
+        done = true;
+      }
+      pause = true;
+      m.release();
+      delete s;
+      return true;
+    }
+
+    void
+    PBS::userstop(void) {
+      m.acquire();
+      has_stopped = true;
+      pause = true;
+      m.release();
+    }
+
+    void
+    PBS::complete(void) {
+      m.acquire();
+      done = true;
+      pause = true;
+      m.release();
+    }
+
+    void
+    PBS::retire(Slave& a) {
+      m.acquire();
+      a.retired = true;
+      // Other assets continue unless all assets are exhausted
+      if (--n_active == 0) {
+        done = true;
+        pause = true;
+      }
+      m.release();
+    }
+
+    void
+    PBS::ack(void) {
+      m.acquire();
+      bool last = (--n_busy == 0);
+      m.release();
+      if (last)
+        e_done.signal();
+    }
+
+    void
+    PBS::sync(Slave& a) {
+      m.acquire();
+      if ((best == NULL) || (a.stop.v == version)) {
+        m.release();
+        return;
+      }
+      Space* b = best->clone(false);
+      a.stop.v = version;
+      m.release();
+      a.e->constrain(*b);
+      delete b;
+    }
+
+
+    /*
+     * Engine interface
+     *
+     */
+    PBS::PBS(Space* s, size_t sz, const Asset* a, unsigned int n0,
+             const Options& o)
+      : n(n0), n_active(0), slaves(NULL), bs(false), n_busy(0),
+        pause(false), version(0), best(NULL), sol(NULL), done(false),
+        has_stopped(false), terminate(false) {
+      // Search is complete if any space to be searched is failed
+      bool failed = (s->status() == SS_FAILED);
+      for (unsigned int i=0; i<n; i++)
+        if ((a[i].space != NULL) && (a[i].space->status() == SS_FAILED))
+          failed = true;
+      if (failed) {
+        n = 0;
+      } else {
+        slaves = heap.alloc<Slave*>(n);
+        for (unsigned int i=0; i<n; i++) {
+          bs |= bestengine(a[i].engine);
+          slaves[i] = new Slave(*this,o.stop);
+          slaves[i]->complete = completeengine(a[i].engine);
+          Options ao(a[i].opt);
+          ao.stop = &slaves[i]->stop;
+          ao.clone = false;
+          Space* r = (a[i].space != NULL) ? a[i].space : s;
+          slaves[i]->e = engine(a[i].engine,r->clone(false),sz,ao);
+        }
+      }
+      if (!o.clone)
+        delete s;
+      n_active = n;
+      if (n == 0)
+        done = true;
+      // Start all assets, they wait until search is resumed
+      for (unsigned int i=0; i<n; i++)
+        Support::Thread::run(slaves[i]);
+    }
+
+    Space*
+    PBS::next(void) {
+      m.acquire();
+      if (done) {
+        has_stopped = false;
+        m.release();
+        return NULL;
+      }
+      has_stopped = false;
+      pause = false;
+      n_busy = n_active;
+      m.release();
+      // Retired assets are not resumed
+      for (unsigned int i=0; i<n; i++)
+        if (!slaves[i]->retired)
+          slaves[i]->e_resume.signal();
+      // Wait until all assets have finished the round
+      e_done.wait();
+      m.acquire();
+      Space* s = sol;
+      sol = NULL;
+      // Solutions and complete search take precedence over stopping
+      if ((s != NULL) || done)
+        has_stopped = false;
+      m.release();
+      return s;
+    }
+
+    Statistics
+    PBS::statistics(void) const {
+      Statistics s;
+      for (unsigned int i=0; i<n; i++)
+        s += slaves[i]->e->statistics();
+      return s;
+    }
+
+    bool
+    PBS::stopped(void) const {
+      return has_stopped;
+    }
+
+    PBS::~PBS(void) {
+      if (n > 0) {
+        m.acquire();
+        terminate = true;
+        n_busy = n;
+        m.release();
+        for (unsigned int i=0; i<n; i++)
+          slaves[i]->e_resume.signal();
+        // Wait until all assets have terminated (they delete themselves)
+        e_done.wait();
+        heap.free<Slave*>(slaves,n);
+      }
+      delete best;
+      delete sol;
+    }
+
+#endif
+
+  }
+
+  Engine*
+  pbs(Space* s, size_t sz, const Asset* a, unsigned int n, 
+      const Options& o) {
+#ifdef GECODE_HAS_THREADS
+    return sink(new Meta::PBS(s,sz,a,n,o),o);
+#else
+    // Without threads, only the first asset is run
+    Options ao(a[0].opt);
+    ao.stop = o.stop;
+    ao.clone = o.clone;
+    if (a[0].space != NULL) {
+      if (!o.clone)
+        delete s;
+      s = a[0].space;
+      ao.clone = true;
+    }
+    return sink(Meta::engine(a[0].engine,s,sz,ao),o);
+#endif
+  }
+
+}}
+
+// STATISTICS: search-other
@@ -0,0 +1,97 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  namespace Search {
+
+    forceinline
+    Asset::Asset(void) 
+      : engine(AE_DFS), space(NULL) {}
+
+    forceinline
+    Asset::Asset(AssetEngine e, const Options& o, Space* s) 
+      : engine(e), opt(o), space(s) {}
+
+    /// Create portfolio engine
+    GECODE_SEARCH_EXPORT Engine* pbs(Space* s, size_t sz, 
+                                     const Asset* a, unsigned int n,
+                                     const Options& o);
+  }
+
+  template<class T>
+  forceinline
+  PBS<T>::PBS(T* s, const Search::Asset* a, unsigned int n,
+              const Search::Options& o)
+    : e(Search::pbs(s,sizeof(T),a,n,o)) {}
+
+  template<class T>
+  forceinline T*
+  PBS<T>::next(void) {
+    return dynamic_cast<T*>(e->next());
+  }
+
+  template<class T>
+  forceinline Search::Statistics
+  PBS<T>::statistics(void) const {
+    return e->statistics();
+  }
+
+  template<class T>
+  forceinline bool
+  PBS<T>::stopped(void) const {
+    return e->stopped();
+  }
+
+  template<class T>
+  forceinline
+  PBS<T>::~PBS(void) {
+    delete e;
+  }
+
+
+  template<class T>
+  forceinline T*
+  pbs(T* s, const Search::Asset* a, unsigned int n, 
+      const Search::Options& o) {
+    PBS<T> p(s,a,n,o);
+    return p.next();
+  }
+
+}
+
+// STATISTICS: search-other
@@ -0,0 +1,151 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+#include <gecode/search/meta/rbs.hh>
+#include <gecode/search/support.hh>
+
+namespace Gecode { namespace Search {
+
+  namespace Meta {
+
+    void
+    RBS::engine(Space* s) {
+      if (opt.cutoff != NULL)
+        rs.limit((*opt.cutoff)());
+      e = Search::dfs(s,sz,opt);
+    }
+
+    RBS::RBS(Space* s, size_t sz0, const Options& o)
+      : rs(o.stop), opt(o), sz(sz0), best(NULL) {
+      root = (s->status() == SS_FAILED) ? NULL : s->clone();
+      opt.stop = &rs;
+      engine(s);
+      opt.clone = false;
+    }
+
+    Space*
+    RBS::next(void) {
+      rs.start();
+      if (best != NULL) {
+        // Restart with constrained root
+        root->constrain(*best);
+        delete best; best = NULL;
+        if (root->status() == SS_FAILED) {
+          delete root; root = NULL;
+        }
+        rs.update(e->statistics());
+        delete e;
+        if (root == NULL) {
+          e = NULL;
+          return NULL;
+        }
+        engine(root->clone());
+      }
+      if (e == NULL)
+        return NULL;
+      while (true) {
+        Space* n = e->next();
+        if (n != NULL) {
+          best = n->clone();
+          return n;
+        }
+        // Search is complete or has been stopped by the user
+        if (!e->stopped() || rs.enginestopped() || (root == NULL))
+          return NULL;
+        // Cutoff has been reached: restart
+        rs.update(e->statistics());
+        if (opt.nogoods_limit > 0) {
+          // Record no-goods from the current path in the root
+          e->nogoods(*root,opt.nogoods_limit);
+          if (root->status() == SS_FAILED) {
+            delete root; root = NULL;
+            delete e; e = NULL;
+            return NULL;
+          }
+        }
+        delete e;
+        engine(root->clone());
+      }
+      GECODE_NEVER;
+      return NULL;
+    }
+
+    Statistics
+    RBS::statistics(void) const {
+      Statistics s = rs.metastatistics();
+      if (e != NULL) {
+        Statistics t = e->statistics();
+        size_t mem = std::max(s.memory,t.memory);
+        s += t;
+        s.memory = mem;
+      }
+      return s;
+    }
+
+    bool
+    RBS::stopped(void) const {
+      return rs.enginestopped();
+    }
+
+    void
+    RBS::constrain(const Space& b) {
+      if (root == NULL)
+        return;
+      // Search is restarted from the constrained root by next()
+      if (best != NULL)
+        root->constrain(*best);
+      delete best;
+      best = b.clone(false);
+    }
+
+    RBS::~RBS(void) {
+      delete best;
+      delete root;
+      delete e;
+    }
+
+  }
+
+  Engine*
+  rbs(Space* s, size_t sz, const Options& o) {
+    return sink(new Meta::RBS(s,sz,nosink(o)),o);
+  }
+
+}}
+
+// STATISTICS: search-other
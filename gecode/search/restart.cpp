@@ -49,11 +49,11 @@ namespace Gecode { namespace Search {
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
     if (to.threads == 1.0)
-      return new WorkerToEngine<Sequential::Restart>(s,sz,to);
+      return sink(new BestWorkerToEngine<Sequential::Restart>(s,sz,to),to);
     else
-      return new Parallel::Restart(s,sz,to);
+      return sink(new Parallel::Restart(s,sz,nosink(to)),to);
 #else
-    return new WorkerToEngine<Sequential::Restart>(s,sz,o);
+    return sink(new BestWorkerToEngine<Sequential::Restart>(s,sz,o),o);
 #endif
   }
 
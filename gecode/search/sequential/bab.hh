@@ -71,13 +71,15 @@ namespace Gecode { namespace Search { namespace Sequential {
     Space* next(void);
     /// Return statistics
     Statistics statistics(void) const;
+    /// Constrain future solutions to be better than \a b
+    void constrain(const Space& b);
     /// Destructor
     ~BAB(void);
   };
 
   forceinline 
   BAB::BAB(Space* s, size_t sz, const Options& o)
-    : Worker(sz), opt(o), d(0), mark(0), best(NULL) {
+    : Worker(sz,o.profile), opt(o), d(0), mark(0), best(NULL) {
     cur = (s->status(*this) == SS_FAILED) ? NULL : snapshot(s,opt);
     current(s);
     current(NULL);
@@ -123,8 +125,8 @@ namespace Gecode { namespace Search { namespace Sequential {
         case SS_BRANCH:
           {
             Space* c;
-            if ((d == 0) || (d >= opt.c_d)) {
-              c = cur->clone();
+            if (path.clone(d,c_d(opt,path.entries()))) {
+              c = cur->clone(true,*this);
               d = 1;
             } else {
               c = NULL;
@@ -143,7 +145,7 @@ namespace Gecode { namespace Search { namespace Sequential {
       do {
         if (!path.next(*this))
           return NULL;
-        cur = path.recompute(d,opt.a_d,*this,best,mark);
+        cur = path.recompute(d,a_d(opt),*this,best,mark);
       } while (cur == NULL);
       Worker::current(cur);
     }
@@ -158,6 +160,24 @@ namespace Gecode { namespace Search { namespace Sequential {
     return s;
   }
 
+  forceinline void
+  BAB::constrain(const Space& b) {
+    Space* c = b.clone(false);
+    if (best != NULL) {
+      // Check whether b is in fact better
+      c->constrain(*best);
+      if (c->status() == SS_FAILED) {
+        delete c;
+        return;
+      }
+      delete best;
+    }
+    best = c;
+    mark = path.entries();
+    if (cur != NULL)
+      cur->constrain(*best);
+  }
+
   forceinline 
   BAB::~BAB(void) {
     path.reset();
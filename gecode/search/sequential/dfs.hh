@@ -66,13 +66,15 @@ namespace Gecode { namespace Search { namespace Sequential {
     Space* next(void);
     /// Return statistics
     Statistics statistics(void) const;
+    /// Post no-goods for at most \a l levels of the current path on \a home
+    void nogoods(Space& home, unsigned int l) const;
     /// Destructor
     ~DFS(void);
   };
 
   forceinline 
   DFS::DFS(Space* s, size_t sz, const Options& o)
-    : Worker(sz), opt(o), d(0) {
+    : Worker(sz,o.profile), opt(o), d(0) {
     cur = (s->status(*this) == SS_FAILED) ? NULL : snapshot(s,opt);
     current(s);
     current(NULL);
@@ -124,8 +126,8 @@ namespace Gecode { namespace Search { namespace Sequential {
         case SS_BRANCH:
           {
             Space* c;
-            if ((d == 0) || (d >= opt.c_d)) {
-              c = cur->clone();
+            if (path.clone(d,c_d(opt,path.entries()))) {
+              c = cur->clone(true,*this);
               d = 1;
             } else {
               c = NULL;
@@ -143,7 +145,7 @@ namespace Gecode { namespace Search { namespace Sequential {
       do {
         if (!path.next(*this))
           return NULL;
-        cur = path.recompute(d,opt.a_d,*this);
+        cur = path.recompute(d,a_d(opt),*this);
       } while (cur == NULL);
       Worker::current(cur);
     }
@@ -158,6 +160,11 @@ namespace Gecode { namespace Search { namespace Sequential {
     return s;
   }
 
+  forceinline void
+  DFS::nogoods(Space& home, unsigned int l) const {
+    path.post(home,l);
+  }
+
   forceinline 
   DFS::~DFS(void) {
     delete cur;
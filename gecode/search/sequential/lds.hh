@@ -0,0 +1,184 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_SEQUENTIAL_LDS_HH__
+#define __GECODE_SEARCH_SEQUENTIAL_LDS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/worker.hh>
+#include <gecode/search/sequential/path.hh>
+
+namespace Gecode { namespace Search { namespace Sequential {
+
+  /**
+   * \brief Limited discrepancy search engine implementation
+   *
+   * The search tree is explored by a sequence of depth-first probes
+   * with increasing discrepancy limit, starting with zero. Taking
+   * alternative \f$i\f$ of a choice counts as \f$i\f$ discrepancies.
+   * A probe only reports solutions that are reached with exactly as
+   * many discrepancies as its limit, so that each solution is
+   * reported once.
+   */
+  class LDS : public Worker {
+  private:
+    /// Search options
+    Options opt;
+    /// Current path ins search tree
+    Path path;
+    /// Root node for probing (NULL if search is complete)
+    Space* root;
+    /// Current space being explored
+    Space* cur;
+    /// Distance until next clone
+    unsigned int d;
+    /// Current discrepancy limit
+    unsigned int dl;
+    /// Number of discrepancies of current path
+    unsigned int dc;
+    /// Whether the current probe has skipped alternatives
+    bool pruned;
+  public:
+    /// Initialize for space \a s (of size \a sz) with options \a o
+    LDS(Space* s, size_t sz, const Options& o);
+    /// %Search for next solution
+    Space* next(void);
+    /// Return statistics
+    Statistics statistics(void) const;
+    /// Destructor
+    ~LDS(void);
+  };
+
+  forceinline 
+  LDS::LDS(Space* s, size_t sz, const Options& o)
+    : Worker(sz,o.profile), opt(o), d(0), dl(0), dc(0), pruned(false) {
+    root = (s->status(*this) == SS_FAILED) ? NULL : snapshot(s,opt);
+    cur = (root == NULL) ? NULL : root->clone();
+    current(s);
+    current(NULL);
+    current(cur);
+    if (cur == NULL)
+      fail++;
+  }
+
+  forceinline Space*
+  LDS::next(void) {
+    start();
+    while (true) {
+      while (cur) {
+        if (stop(opt,path.size()))
+          return NULL;
+        node++;
+        switch (cur->status(*this)) {
+        case SS_FAILED:
+          fail++;
+          delete cur;
+          cur = NULL;
+          Worker::current(NULL);
+          break;
+        case SS_SOLVED:
+          {
+            // Deletes all pending branchers
+            (void) cur->choice();
+            Space* s = cur;
+            cur = NULL;
+            Worker::current(NULL);
+            // Solutions with fewer discrepancies have been found before
+            if (dc == dl)
+              return s;
+            delete s;
+            break;
+          }
+        case SS_BRANCH:
+          {
+            Space* c;
+            if (path.clone(d,c_d(opt,path.entries()))) {
+              c = cur->clone(true,*this);
+              d = 1;
+            } else {
+              c = NULL;
+              d++;
+            }
+            const Choice* ch = path.push(*this,cur,c);
+            Worker::push(c,ch);
+            cur->commit(*ch,0);
+            break;
+          }
+        default:
+          GECODE_NEVER;
+        }
+      }
+      do {
+        if (path.next(*this,dc,dl,pruned)) {
+          cur = path.recompute(d,a_d(opt),*this);
+        } else {
+          // Probe is complete: is there any point in another one?
+          if (!pruned || (dl >= opt.d_l)) {
+            delete root; root = NULL;
+          }
+          if (root == NULL)
+            return NULL;
+          dl++; pruned = false; d = 0;
+          cur = root->clone();
+        }
+      } while (cur == NULL);
+      Worker::current(cur);
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  forceinline Statistics
+  LDS::statistics(void) const {
+    Statistics s = *this;
+    s.memory += path.size();
+    return s;
+  }
+
+  forceinline 
+  LDS::~LDS(void) {
+    delete root;
+    delete cur;
+    path.reset();
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-sequential
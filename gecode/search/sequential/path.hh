@@ -38,7 +38,11 @@
 #ifndef __GECODE_SEARCH_SEQUENTIAL_PATH_HH__
 #define __GECODE_SEARCH_SEQUENTIAL_PATH_HH__
 
+#include <algorithm>
+#include <climits>
+
 #include <gecode/search.hh>
+#include <gecode/search/nogoods.hh>
 
 namespace Gecode { namespace Search { namespace Sequential {
 
@@ -100,12 +104,28 @@ namespace Gecode { namespace Search { namespace Sequential {
     const Choice* push(Worker& stat, Space* s, Space* c);
     /// Generate path for next node and return whether a next node exists
     bool next(Worker& s);
+    /**
+     * \brief Generate path for next node within discrepancy limit
+     *
+     * The number of discrepancies \a dc of the current path is updated
+     * and must not exceed \a dl. If an alternative is skipped due to the
+     * discrepancy limit, \a p is set to true.
+     */
+    bool next(Worker& s, unsigned int& dc, unsigned int dl, bool& p);
     /// Provide access to topmost edge
     Edge& top(void) const;
     /// Test whether path is empty
     bool empty(void) const;
     /// Return position on stack of last copy
     int lc(void) const;
+    /**
+     * \brief Test whether to clone at distance \a d for commit distance \a c_d
+     *
+     * A distance of zero requires a clone, unless the memory limit
+     * has been reached (\a c_d is UINT_MAX) and recomputation can
+     * start from a clone already on the stack.
+     */
+    bool clone(unsigned int d, unsigned int c_d) const;
     /// Unwind the stack up to position \a l (after failure)
     void unwind(int l);
     /// Commit space \a s as described by stack entry at position \a i
@@ -121,6 +141,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     size_t size(void) const;
     /// Reset stack
     void reset(void);
+    /// Post no-goods for the first \a l edges of the path on \a home
+    void post(Space& home, unsigned int l) const;
   };
 
 
@@ -199,6 +221,23 @@ namespace Gecode { namespace Search { namespace Sequential {
     return false;
   }
 
+  forceinline bool
+  Path::next(Worker& stat, unsigned int& dc, unsigned int dl, bool& p) {
+    while (!ds.empty()) {
+      if (!ds.top().rightmost()) {
+        if (dc < dl) {
+          ds.top().next(); dc++;
+          return true;
+        }
+        p = true;
+      }
+      dc -= ds.top().alt();
+      stat.pop(ds.top().space(),ds.top().choice());
+      ds.pop().dispose();
+    }
+    return false;
+  }
+
   forceinline Path::Edge&
   Path::top(void) const {
     assert(!ds.empty());
@@ -224,6 +263,18 @@ namespace Gecode { namespace Search { namespace Sequential {
     return l;
   }
 
+  forceinline bool
+  Path::clone(unsigned int d, unsigned int c_d) const {
+    if (d > 0)
+      return d >= c_d;
+    if (c_d < UINT_MAX)
+      return true;
+    for (int l=ds.entries(); l--; )
+      if (ds[l].space() != NULL)
+        return false;
+    return true;
+  }
+
   forceinline int
   Path::entries(void) const {
     return ds.entries();
@@ -249,6 +300,38 @@ namespace Gecode { namespace Search { namespace Sequential {
       ds.pop().dispose();
   }
 
+  inline void
+  Path::post(Space& home, unsigned int l) const {
+    int n = std::min(static_cast<int>(l),ds.entries());
+    // First, last, and last leaf literal of the list
+    NGL* f = NULL; NGL* t = NULL; NGL* lf = NULL;
+    for (int i=0; i<n; i++) {
+      const Choice& c = *ds[i].choice();
+      // All alternatives to the left have been explored completely
+      for (unsigned int a=0; a<ds[i].alt(); a++)
+        if (NGL* g = home.ngl(c,a)) {
+          g->leaf(true);
+          if (t == NULL) f = g; else t->next(g);
+          t = lf = g;
+        }
+      NGL* g = home.ngl(c,ds[i].alt());
+      if (g == NULL)
+        break;
+      if (t == NULL) f = g; else t->next(g);
+      t = g;
+    }
+    if (lf == NULL) {
+      // No leaf, hence no no-goods
+      NoGoodsProp::dispose(home,f);
+      return;
+    }
+    // Decisions after the last leaf are not needed
+    NoGoodsProp::dispose(home,lf->next());
+    lf->next(NULL);
+    if (NoGoodsProp::post(home,f) == ES_FAILED)
+      home.fail();
+  }
+
   forceinline Space*
   Path::recompute(unsigned int& d, unsigned int a_d, Worker& stat) {
     assert(!ds.empty());
@@ -271,7 +354,7 @@ namespace Gecode { namespace Search { namespace Sequential {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(true,stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -301,7 +384,7 @@ namespace Gecode { namespace Search { namespace Sequential {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
@@ -355,11 +438,11 @@ namespace Gecode { namespace Search { namespace Sequential {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(true,stat);
       ds[l].space(c);
       stat.constrained(s,c);
     } else {
-      s = s->clone();
+      s = s->clone(true,stat);
     }
 
     if (d < a_d) {
@@ -393,7 +476,7 @@ namespace Gecode { namespace Search { namespace Sequential {
           unwind(i);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(true,stat));
         stat.adapt(ds[i].space());
         d = static_cast<unsigned int>(n-i);
       }
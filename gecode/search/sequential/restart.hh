@@ -54,6 +54,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     Restart(Space* s, size_t sz, const Search::Options& o);
     /// Return next better solution (NULL, if none exists or search has been stopped)
     Space* next(void);
+    /// Constrain future solutions to be better than \a b
+    void constrain(const Space& b);
     /// Destructor
     ~Restart(void);
   };
@@ -76,6 +78,18 @@ namespace Gecode { namespace Search { namespace Sequential {
     return (best != NULL) ? best->clone() : NULL;
   }
 
+  forceinline void
+  Restart::constrain(const Space& b) {
+    if (root == NULL)
+      return;
+    if (best != NULL) {
+      root->constrain(*best);
+      delete best; best = NULL;
+    }
+    root->constrain(b);
+    root = reset(root);
+  }
+
   forceinline 
   Restart::~Restart(void) {
     delete best;
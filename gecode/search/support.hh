@@ -62,6 +62,8 @@ namespace Gecode { namespace Search {
     virtual Search::Statistics statistics(void) const;
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /// Post no-goods for at most \a l levels of the current path on \a home
+    virtual void nogoods(Space& home, unsigned int l) const;
   };
 
   template<class Worker>
@@ -83,6 +85,101 @@ namespace Gecode { namespace Search {
   WorkerToEngine<Worker>::stopped(void) const {
     return w.stopped();
   }
+  template<class Worker>
+  void 
+  WorkerToEngine<Worker>::nogoods(Space& home, unsigned int l) const {
+    w.nogoods(home,l);
+  }
+
+  /// Engine passing all solutions of an engine to a sink
+  class SinkEngine : public Engine {
+  protected:
+    /// The engine
+    Engine* e;
+    /// The sink
+    Sink* sink;
+  public:
+    /// Initialization for engine \a e and sink \a s
+    SinkEngine(Engine* e, Sink* s);
+    /// Pass all solutions to the sink and return NULL
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Post no-goods for at most \a l levels of the current path on \a home
+    virtual void nogoods(Space& home, unsigned int l) const;
+    /// Destructor
+    virtual ~SinkEngine(void);
+  };
+
+  forceinline
+  SinkEngine::SinkEngine(Engine* e0, Sink* s)
+    : e(e0), sink(s) {}
+  inline Space*
+  SinkEngine::next(void) {
+    while (Space* s = e->next()) {
+      sink->solution(*s);
+      delete s;
+    }
+    return NULL;
+  }
+  inline Search::Statistics
+  SinkEngine::statistics(void) const {
+    return e->statistics();
+  }
+  inline bool
+  SinkEngine::stopped(void) const {
+    return e->stopped();
+  }
+  inline void
+  SinkEngine::constrain(const Space& b) {
+    e->constrain(b);
+  }
+  inline void
+  SinkEngine::nogoods(Space& home, unsigned int l) const {
+    e->nogoods(home,l);
+  }
+  inline
+  SinkEngine::~SinkEngine(void) {
+    delete e;
+  }
+
+  /// Return engine \a e, passing solutions to the sink of \a o (if any)
+  forceinline Engine*
+  sink(Engine* e, const Options& o) {
+    return (o.sink == NULL) ? e : new SinkEngine(e,o.sink);
+  }
+
+  /// Return options \a o without sink
+  forceinline Options
+  nosink(const Options& o) {
+    Options so(o);
+    so.sink = NULL;
+    return so;
+  }
+
+  /// Virtualize a worker for best solution search to an engine
+  template<class Worker>
+  class BestWorkerToEngine : public WorkerToEngine<Worker> {
+  public:
+    /// Initialization
+    BestWorkerToEngine(Space* s, size_t sz, const Options& o);
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+  };
+
+  template<class Worker>
+  BestWorkerToEngine<Worker>::BestWorkerToEngine(Space* s, size_t sz, 
+                                                 const Options& o) 
+    : WorkerToEngine<Worker>(s,sz,o) {}
+  template<class Worker>
+  void
+  BestWorkerToEngine<Worker>::constrain(const Space& b) {
+    this->w.constrain(b);
+  }
 
 }}
 
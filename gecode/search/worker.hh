@@ -38,6 +38,8 @@
 #ifndef __GECODE_SEARCH_WORKER_HH__
 #define __GECODE_SEARCH_WORKER_HH__
 
+#include <climits>
+
 #include <gecode/search.hh>
 
 namespace Gecode { namespace Search {
@@ -55,17 +57,32 @@ namespace Gecode { namespace Search {
     size_t mem_cur;
     /// Current total memory
     size_t mem_total;
+    /// Memory for the last clone stored (zero if none)
+    size_t mem_clone;
     /// Depth of root node (for work stealing)
     unsigned long int root_depth;
   public:
-    /// Initialize with space size \a sz
-    Worker(size_t sz);
+    /**
+     * \brief Initialize with space size \a sz and profile \a p
+     *
+     * If \a p is not NULL, the worker records propagator executions
+     * in its own profile with parent \a p.
+     */
+    Worker(size_t sz, PropagatorProfile* p=NULL);
+    /// Destructor
+    ~Worker(void);
     /// Reset stop information
     void start(void);
     /// Check whether engine must be stopped (with additional stackspace \a sz)
     bool stop(const Options& o, size_t sz);
     /// Check whether engine has been stopped
     bool stopped(void) const;
+    /// Post no-goods on \a home (none by default)
+    void nogoods(Space& home, unsigned int l) const;
+    /// Return commit distance for options \a o with \a e stack entries
+    unsigned int c_d(const Options& o, int e) const;
+    /// Return adaptive distance for options \a o
+    unsigned int a_d(const Options& o) const;
     /// New space \a s and choice \a c get pushed on stack
     void push(const Space* s, const Choice* c);
     /// Space \a s1 is replaced by space \a s2 due to constraining
@@ -91,10 +108,16 @@ namespace Gecode { namespace Search {
 
 
   forceinline
-  Worker::Worker(size_t sz)
+  Worker::Worker(size_t sz, PropagatorProfile* p)
     : _stopped(false), mem_space(sz), mem_cur(0), mem_total(0), 
-      root_depth(0) {
+      mem_clone(0), root_depth(0) {
     memory = 0;
+    profile = (p != NULL) ? new PropagatorProfile(p) : NULL;
+  }
+
+  forceinline
+  Worker::~Worker(void) {
+    delete profile;
   }
 
   forceinline void
@@ -117,10 +140,41 @@ namespace Gecode { namespace Search {
     return _stopped;
   }
 
+  forceinline void
+  Worker::nogoods(Space&, unsigned int) const {}
+
+  forceinline unsigned int
+  Worker::c_d(const Options& o, int e) const {
+    if ((o.memory_limit == 0) || (mem_clone == 0))
+      return o.c_d;
+    if (mem_total + mem_clone > o.memory_limit)
+      return UINT_MAX;
+    // Number of clones that still fit into the memory limit
+    unsigned long int n = 
+      static_cast<unsigned long int>((o.memory_limit - mem_total) / 
+                                     mem_clone);
+    // Remaining depth as estimated from the maximal depth so far
+    unsigned long int d = root_depth + static_cast<unsigned long int>(e);
+    unsigned long int r = (depth > d) ? depth - d : 1UL;
+    // Smallest distance such that clones for the remaining depth fit
+    unsigned long int c = (r + n - 1) / n;
+    if (c <= o.c_d)
+      return o.c_d;
+    return (c < UINT_MAX) ? static_cast<unsigned int>(c) : UINT_MAX;
+  }
+
+  forceinline unsigned int
+  Worker::a_d(const Options& o) const {
+    return ((o.memory_limit > 0) && 
+            (mem_total + mem_clone > o.memory_limit)) ? UINT_MAX : o.a_d;
+  }
+
   forceinline void
   Worker::push(const Space* s, const Choice* c) {
-    if (s != NULL)
-      mem_total += mem_space + s->allocated();
+    if (s != NULL) {
+      mem_clone = mem_space + s->allocated();
+      mem_total += mem_clone;
+    }
     mem_total += c->size();
     if (mem_total > memory)
       memory = mem_total;
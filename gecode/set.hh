@@ -1010,6 +1010,8 @@ namespace Gecode {
     SET_VAR_DEGREE_MAX, ///< With largest degree
     SET_VAR_AFC_MIN,    ///< With smallest accumulated failure count
     SET_VAR_AFC_MAX,    ///< With largest accumulated failure count
+    SET_VAR_ACTIVITY_MIN, ///< With smallest activity
+    SET_VAR_ACTIVITY_MAX, ///< With largest activity
     SET_VAR_MIN_MIN,    ///< With smallest minimum unknown element
     SET_VAR_MIN_MAX,    ///< With largest minimum unknown element
     SET_VAR_MAX_MIN,    ///< With smallest maximum unknown element
@@ -1019,7 +1021,9 @@ namespace Gecode {
     SET_VAR_SIZE_DEGREE_MIN, ///< With smallest domain size divided by degree
     SET_VAR_SIZE_DEGREE_MAX, ///< With largest domain size divided by degree
     SET_VAR_SIZE_AFC_MIN, ///< With smallest domain size divided by accumulated failure count
-    SET_VAR_SIZE_AFC_MAX  ///< With largest domain size divided by accumulated failure count
+    SET_VAR_SIZE_AFC_MAX, ///< With largest domain size divided by accumulated failure count
+    SET_VAR_SIZE_ACTIVITY_MIN, ///< With smallest domain size divided by activity
+    SET_VAR_SIZE_ACTIVITY_MAX  ///< With largest domain size divided by activity
   };
 
   /// Which values to select first for branching
@@ -148,6 +148,8 @@ namespace Gecode { namespace Set { namespace Branch {
     int val(Space& home, SetView x);
     /// Tell \f$x\leq n\f$ (\a a = 0) or \f$x\neq n\f$ (\a a = 1)
     ModEvent tell(Space& home, unsigned int a, SetView x, int n);
+    /// Return no-good literal for alternative \a a (none)
+    NGL* ngl(Space& home, unsigned int a, SetView x, int n) const;
     /// Return choice
     Support::RandomGenerator choice(Space& home);
     /// Commit to choice
@@ -425,6 +427,50 @@ namespace Gecode { namespace Set { namespace Branch {
     ViewSelStatus select(Space& home, SetView x);
   };
 
+  /**
+   * \brief View selection class for view with smallest cardinality of lub-glb 
+   * divided by activity
+   *
+   * Requires \code #include <gecode/set/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeActivityMin : public ViewSelBase<SetView> {
+  protected:
+    /// So-far smallest size/activity
+    double sizeact;
+  public:
+    /// Default constructor
+    BySizeActivityMin(void);
+    /// Constructor for initialization
+    BySizeActivityMin(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x
+    ViewSelStatus init(Space& home, SetView x);
+    /// Possibly select better view \a x
+    ViewSelStatus select(Space& home, SetView x);
+  };
+
+  /**
+   * \brief View selection class for view with largest cardinality of lub-glb 
+   * divided by activity
+   *
+   * Requires \code #include <gecode/set/branch.hh> \endcode
+   * \ingroup FuncIntSelView
+   */
+  class BySizeActivityMax : public ViewSelBase<SetView> {
+  protected:
+    /// So-far largest size/activity
+    double sizeact;
+  public:
+    /// Default constructor
+    BySizeActivityMax(void);
+    /// Constructor for initialization
+    BySizeActivityMax(Space& home, const VarBranchOptions& vbo);
+    /// Intialize with view \a x
+    ViewSelStatus init(Space& home, SetView x);
+    /// Possibly select better view \a x
+    ViewSelStatus select(Space& home, SetView x);
+  };
+
 }}}
 
 #include <gecode/set/branch/select-val.hpp>
@@ -64,6 +64,12 @@ namespace Gecode { namespace Set { namespace Branch {
     case SET_VAR_AFC_MAX:
       v = new (home) ViewSelVirtual<ViewSelAfcMax<SetView> >(home,o_vars);
       break;
+    case SET_VAR_ACTIVITY_MIN:
+      v = new (home) ViewSelVirtual<ViewSelActivityMin<SetView> >(home,o_vars);
+      break;
+    case SET_VAR_ACTIVITY_MAX:
+      v = new (home) ViewSelVirtual<ViewSelActivityMax<SetView> >(home,o_vars);
+      break;
     case SET_VAR_MIN_MIN:
       v = new (home) ViewSelVirtual<ByMinMin>(home,o_vars);
       break;
@@ -94,6 +100,12 @@ namespace Gecode { namespace Set { namespace Branch {
     case SET_VAR_SIZE_AFC_MAX:
       v = new (home) ViewSelVirtual<BySizeAfcMax>(home,o_vars);
       break;
+    case SET_VAR_SIZE_ACTIVITY_MIN:
+      v = new (home) ViewSelVirtual<BySizeActivityMin>(home,o_vars);
+      break;
+    case SET_VAR_SIZE_ACTIVITY_MAX:
+      v = new (home) ViewSelVirtual<BySizeActivityMax>(home,o_vars);
+      break;
     default:
       throw UnknownBranching("Set::branch");
     }
@@ -152,6 +164,18 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.bf);
       }
       break;
+    case SET_VAR_ACTIVITY_MIN:
+      {
+        ViewSelActivityMin<SetView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
+    case SET_VAR_ACTIVITY_MAX:
+      {
+        ViewSelActivityMax<SetView> v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
     case SET_VAR_MIN_MIN:
       {
         ByMinMin v(home,o_vars);
@@ -212,6 +236,18 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.bf);
       }
       break;
+    case SET_VAR_SIZE_ACTIVITY_MIN:
+      {
+        BySizeActivityMin v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
+    case SET_VAR_SIZE_ACTIVITY_MAX:
+      {
+        BySizeActivityMax v(home,o_vars);
+        post(home,xv,v,vals,o_vals,o_vars.bf);
+      }
+      break;
     default:
       throw UnknownBranching("Set::branch");
     }
@@ -278,6 +314,22 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.a.bf);
       }
       break;
+    case SET_VAR_ACTIVITY_MIN:
+      {
+        ViewSelActivityMin<SetView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMin<SetView>,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
+    case SET_VAR_ACTIVITY_MAX:
+      {
+        ViewSelActivityMax<SetView> va(home,o_vars.a);
+        ViewSelTieBreakStatic<ViewSelActivityMax<SetView>,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
     case SET_VAR_MIN_MIN:
       {
         ByMinMin va(home,o_vars.a);
@@ -358,6 +410,22 @@ namespace Gecode {
         post(home,xv,v,vals,o_vals,o_vars.a.bf);
       }
       break;
+    case SET_VAR_SIZE_ACTIVITY_MIN:
+      {
+        BySizeActivityMin va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeActivityMin,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
+    case SET_VAR_SIZE_ACTIVITY_MAX:
+      {
+        BySizeActivityMax va(home,o_vars.a);
+        ViewSelTieBreakStatic<BySizeActivityMax,
+          ViewSelTieBreakDynamic<SetView> > v(home,va,vbcd);
+        post(home,xv,v,vals,o_vals,o_vars.a.bf);
+      }
+      break;
     default:
       throw UnknownBranching("Set::branch");
     }
@@ -142,6 +142,11 @@ namespace Gecode { namespace Set { namespace Branch {
     return ((a == 0) == inc) ? x.include(home,v) : x.exclude(home,v);
   }
   template<bool inc>
+  forceinline NGL*
+  ValRnd<inc>::ngl(Space&, unsigned int, SetView, int) const {
+    return NULL;
+  }
+  template<bool inc>
   forceinline Support::RandomGenerator
   ValRnd<inc>::choice(Space&) {
     return r;
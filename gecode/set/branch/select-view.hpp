@@ -301,6 +301,72 @@ namespace Gecode { namespace Set { namespace Branch {
     }
   }
 
+
+  // Select variable with smallest size/activity
+  forceinline
+  BySizeActivityMin::BySizeActivityMin(void) : sizeact(0) {}
+  forceinline
+  BySizeActivityMin::BySizeActivityMin(Space& home,
+                                       const VarBranchOptions& vbo)
+    : ViewSelBase<SetView>(home,vbo), sizeact(0) {
+#ifndef GECODE_HAS_ACTIVITY
+    throw ActivityDisabled("Set::Branch::BySizeActivityMin");
+#endif
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMin::init(Space& home, SetView x) {
+    x.activity(home);
+    UnknownRanges<SetView> u(x);
+    sizeact = static_cast<double>(Iter::Ranges::size(u))/x.activity();
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMin::select(Space& home, SetView x) {
+    x.activity(home);
+    UnknownRanges<SetView> u(x);
+    double sa = static_cast<double>(Iter::Ranges::size(u))/x.activity();
+    if (sa < sizeact) {
+      sizeact = sa; return VSS_BETTER;
+    } else if (sa > sizeact) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+
+
+  // Select variable with largest size/activity
+  forceinline
+  BySizeActivityMax::BySizeActivityMax(void) : sizeact(0) {}
+  forceinline
+  BySizeActivityMax::BySizeActivityMax(Space& home,
+                                       const VarBranchOptions& vbo)
+    : ViewSelBase<SetView>(home,vbo), sizeact(0) {
+#ifndef GECODE_HAS_ACTIVITY
+    throw ActivityDisabled("Set::Branch::BySizeActivityMax");
+#endif
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMax::init(Space& home, SetView x) {
+    x.activity(home);
+    UnknownRanges<SetView> u(x);
+    sizeact = static_cast<double>(Iter::Ranges::size(u))/x.activity();
+    return VSS_BETTER;
+  }
+  forceinline ViewSelStatus
+  BySizeActivityMax::select(Space& home, SetView x) {
+    x.activity(home);
+    UnknownRanges<SetView> u(x);
+    double sa = static_cast<double>(Iter::Ranges::size(u))/x.activity();
+    if (sa > sizeact) {
+      sizeact = sa; return VSS_BETTER;
+    } else if (sa < sizeact) {
+      return VSS_WORSE;
+    } else {
+      return VSS_TIE;
+    }
+  }
+
 }}}
 
 // STATISTICS: set-branch
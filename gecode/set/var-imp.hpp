@@ -524,6 +524,15 @@ namespace Gecode { namespace Set {
     /// The greatest lower bound of the domain
     GLBndSet glb;
 
+    /**
+     * \brief Implementation shared by all variables assigned to the empty set
+     *
+     * An assigned empty set variable is never copied but refers to
+     * \a s_empty (it cannot be modified and has no subscriptions).
+     */
+    GECODE_SET_EXPORT static SetVarImp s_empty;
+    /// Initialize static instance as empty set
+    SetVarImp(void);
   protected:
     /// Constructor for cloning \a x
     SetVarImp(Space& home, bool share, SetVarImp& x);
@@ -133,9 +133,13 @@ namespace Gecode { namespace Set {
 
   SetVarImp*
   SetVarImp::perform_copy(Space& home, bool share) {
+    if ((lub.size() == 0) && (cardMin() == 0) && (cardMax() == 0))
+      return &s_empty;
     return new (home) SetVarImp(home,share,*this);
   }
 
+  SetVarImp SetVarImp::s_empty;
+
 }}
 
 // STATISTICS: set-var
@@ -48,6 +48,9 @@ namespace Gecode { namespace Set {
    *
    */
 
+  forceinline
+  SetVarImp::SetVarImp(void) {}
+
   forceinline
   SetVarImp::SetVarImp(Space& home)
     : SetVarImpBase(home), lub(home), glb(home) {
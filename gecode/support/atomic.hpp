@@ -0,0 +1,204 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#if defined(GECODE_HAS_THREADS) && defined(__GNUC__) && \
+    defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4) && \
+    defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+#define GECODE_HAS_ATOMICS
+#define GECODE_ATOMICS_GCC
+#endif
+
+#if defined(GECODE_THREADS_WINDOWS) && defined(_MSC_VER)
+
+#ifndef NOMINMAX
+#  define NOMINMAX
+#endif
+
+#ifndef _WIN32_WINNT
+#  define _WIN32_WINNT 0x400
+#endif
+
+#ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <windows.h>
+#include <intrin.h>
+
+#define GECODE_HAS_ATOMICS
+#define GECODE_ATOMICS_MSC
+#endif
+
+/**
+ * \defgroup FuncSupportAtomic Atomic operations
+ *
+ * Simple atomic operations as needed for sharing information among
+ * the threads of parallel search engines without locking.
+ *
+ * If the platform (compiler) supports atomic operations, the macro
+ * GECODE_HAS_ATOMICS is defined. If atomic operations are not
+ * supported, all operations are still available but are \e not
+ * atomic: then the caller must synchronize access (for example by
+ * a Support::Mutex).
+ *
+ * \ingroup FuncSupport
+ */
+
+namespace Gecode { namespace Support {
+
+  /**
+   * \brief Replace \a x by \a n if \a x is equal to \a o
+   *
+   * Returns whether \a x has been replaced.
+   * \ingroup FuncSupportAtomic
+   */
+  bool atomic_cas(volatile int& x, int o, int n);
+  /**
+   * \brief Replace \a x by \a n if \a x is equal to \a o
+   *
+   * Equality is tested bitwise. Returns whether \a x has been replaced.
+   * \ingroup FuncSupportAtomic
+   */
+  bool atomic_cas(volatile double& x, double o, double n);
+  /**
+   * \brief Add \a n to \a x and return the new value of \a x
+   * \ingroup FuncSupportAtomic
+   */
+  int atomic_add(volatile int& x, int n);
+  /**
+   * \brief Add \a n to \a x and return the new value of \a x
+   * \ingroup FuncSupportAtomic
+   */
+  double atomic_add(volatile double& x, double n);
+  /**
+   * \brief Full memory barrier
+   * \ingroup FuncSupportAtomic
+   */
+  void atomic_barrier(void);
+
+
+  /// Union for accessing the bits of a double
+  union AtomicDouble {
+    /// The double
+    double d;
+    /// Its bits
+    long long int l;
+  };
+
+#if defined(GECODE_ATOMICS_GCC)
+
+  forceinline bool
+  atomic_cas(volatile int& x, int o, int n) {
+    return __sync_bool_compare_and_swap(&x,o,n);
+  }
+  forceinline bool
+  atomic_cas(volatile double& x, double o, double n) {
+    AtomicDouble ao, an;
+    ao.d = o; an.d = n;
+    return __sync_bool_compare_and_swap
+      (reinterpret_cast<volatile long long int*>(&x),ao.l,an.l);
+  }
+  forceinline int
+  atomic_add(volatile int& x, int n) {
+    return __sync_add_and_fetch(&x,n);
+  }
+  forceinline void
+  atomic_barrier(void) {
+    __sync_synchronize();
+  }
+
+#elif defined(GECODE_ATOMICS_MSC)
+
+  forceinline bool
+  atomic_cas(volatile int& x, int o, int n) {
+    return _InterlockedCompareExchange
+      (reinterpret_cast<volatile long*>(&x),n,o) == o;
+  }
+  forceinline bool
+  atomic_cas(volatile double& x, double o, double n) {
+    AtomicDouble ao, an;
+    ao.d = o; an.d = n;
+    return _InterlockedCompareExchange64
+      (reinterpret_cast<volatile __int64*>(&x),an.l,ao.l) == ao.l;
+  }
+  forceinline int
+  atomic_add(volatile int& x, int n) {
+    return _InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&x),n)
+      + n;
+  }
+  forceinline void
+  atomic_barrier(void) {
+    MemoryBarrier();
+  }
+
+#else
+
+  forceinline bool
+  atomic_cas(volatile int& x, int o, int n) {
+    if (x != o)
+      return false;
+    x = n; return true;
+  }
+  forceinline bool
+  atomic_cas(volatile double& x, double o, double n) {
+    AtomicDouble ax, ao;
+    ax.d = x; ao.d = o;
+    if (ax.l != ao.l)
+      return false;
+    x = n; return true;
+  }
+  forceinline int
+  atomic_add(volatile int& x, int n) {
+    x += n; return x;
+  }
+  forceinline void
+  atomic_barrier(void) {}
+
+#endif
+
+  forceinline double
+  atomic_add(volatile double& x, double n) {
+    double o, r;
+    do {
+      o = x; r = o + n;
+    } while (!atomic_cas(x,o,r));
+    return r;
+  }
+
+}}
+
+// STATISTICS: support-any
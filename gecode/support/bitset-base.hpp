@@ -74,10 +74,10 @@ namespace Gecode { namespace Support {
 #endif
     /// The bits
     Base bits;
+  public:
     /// Bits per base
     static const unsigned int bpb = 
       static_cast<unsigned int>(CHAR_BIT * sizeof(Base));
-  public:
     /// Initialize with all bits set if \a set
     void init(bool set=false);
     /// Get number of data elements for \a s bits
@@ -100,6 +100,14 @@ namespace Gecode { namespace Support {
     bool none(void) const;
     /// Whether no bits from bit 0 to bit \a i are set
     bool none(unsigned int i) const;
+    /// Whether no bit is set both in this and in \a d
+    bool disjoint(BitSetData d) const;
+    /// Keep only the bits that are also set in \a d
+    void a(BitSetData d);
+    /// Also set the bits that are set in \a d
+    void o(BitSetData d);
+    /// Clear the bits that are set in \a d
+    void c(BitSetData d);
   };
 
   /// Status of a bitset
@@ -226,6 +234,22 @@ namespace Gecode { namespace Support {
     const Base mask = (static_cast<Base>(1U) << i) - static_cast<Base>(1U);
     return (bits & mask) == static_cast<Base>(0U);
   }
+  forceinline bool
+  BitSetData::disjoint(BitSetData d) const {
+    return (bits & d.bits) == static_cast<Base>(0U);
+  }
+  forceinline void
+  BitSetData::a(BitSetData d) {
+    bits &= d.bits;
+  }
+  forceinline void
+  BitSetData::o(BitSetData d) {
+    bits |= d.bits;
+  }
+  forceinline void
+  BitSetData::c(BitSetData d) {
+    bits &= ~d.bits;
+  }
 
 
 
@@ -248,6 +248,17 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /**
+     * \brief Bind current thread to processing unit \a pu
+     *
+     * Processing units are numbered among the units the process is
+     * allowed to run on: \a pu is taken modulo their number and
+     * selects the unit at that position of the process's affinity
+     * mask. Returns whether binding is supported and has succeeded.
+     */
+    static bool bind(unsigned int pu);
+    /// Release binding of current thread (runs on all processing units again)
+    static void unbind(void);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
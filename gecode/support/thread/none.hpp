@@ -79,6 +79,12 @@ namespace Gecode { namespace Support {
   Thread::npu(void) {
     return 1;
   }
+  forceinline bool
+  Thread::bind(unsigned int) {
+    return false;
+  }
+  forceinline void
+  Thread::unbind(void) {}
 
 
 }}
@@ -39,6 +39,10 @@
 #include <unistd.h>
 #endif
 
+#ifdef GECODE_HAS_THREAD_AFFINITY
+#include <sched.h>
+#endif
+
 namespace Gecode { namespace Support {
 
   /*
@@ -134,6 +138,42 @@ namespace Gecode { namespace Support {
     return (n>1) ? n : 1;
 #else
     return 1;
+#endif
+  }
+  forceinline bool
+  Thread::bind(unsigned int pu) {
+#ifdef GECODE_HAS_THREAD_AFFINITY
+    // Only use processing units the process is allowed to run on
+    cpu_set_t as;
+    if (sched_getaffinity(getpid(),sizeof(cpu_set_t),&as) != 0)
+      return false;
+    unsigned int n = 0;
+    for (int i=0; i<CPU_SETSIZE; i++)
+      if (CPU_ISSET(i,&as))
+        n++;
+    if (n == 0)
+      return false;
+    // Find the position of the (pu mod n)-th allowed processing unit
+    unsigned int k = pu % n;
+    int i = 0;
+    while (!CPU_ISSET(i,&as) || (k-- > 0))
+      i++;
+    cpu_set_t cs;
+    CPU_ZERO(&cs);
+    CPU_SET(i, &cs);
+    return pthread_setaffinity_np(pthread_self(),sizeof(cpu_set_t),&cs) == 0;
+#else
+    (void) pu;
+    return false;
+#endif
+  }
+  forceinline void
+  Thread::unbind(void) {
+#ifdef GECODE_HAS_THREAD_AFFINITY
+    // Use the processing units available to the process
+    cpu_set_t cs;
+    if (sched_getaffinity(getpid(),sizeof(cpu_set_t),&cs) == 0)
+      (void) pthread_setaffinity_np(pthread_self(),sizeof(cpu_set_t),&cs);
 #endif
   }
 
@@ -102,6 +102,31 @@ namespace Gecode { namespace Support {
     GetSystemInfo(&si);
     return static_cast<unsigned int>(si.dwNumberOfProcessors);
   }
+  forceinline bool
+  Thread::bind(unsigned int pu) {
+    // Only use processing units the process is allowed to run on
+    DWORD_PTR p, s;
+    if (!GetProcessAffinityMask(GetCurrentProcess(),&p,&s) || (p == 0))
+      return false;
+    unsigned int n = 0;
+    for (DWORD_PTR q = p; q != 0; q &= q-1)
+      n++;
+    // Find the (pu mod n)-th allowed processing unit
+    unsigned int k = pu % n;
+    DWORD_PTR m = p & (~p + 1);
+    while (k-- > 0) {
+      p &= p-1;
+      m = p & (~p + 1);
+    }
+    return SetThreadAffinityMask(GetCurrentThread(),m) != 0;
+  }
+  forceinline void
+  Thread::unbind(void) {
+    // Use the processing units available to the process
+    DWORD_PTR p, s;
+    if (GetProcessAffinityMask(GetCurrentProcess(),&p,&s))
+      (void) SetThreadAffinityMask(GetCurrentThread(),p);
+  }
 
 }}
 
@@ -0,0 +1,115 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+#ifdef GECODE_HAS_ACTIVITY
+
+namespace Test {
+
+  /// %Test for activity-based variable selection
+  class Activity : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Three integer variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      TestSpace(Gecode::IntVarBranch vb) : x(*this,3,0,10) {
+        Gecode::branch(*this, x, vb, Gecode::INT_VAL_MIN);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+      /// Modify variable \a i once
+      void modify(int i) {
+        Gecode::rel(*this, x[i], Gecode::IRT_LE, x[i].max());
+        (void) status();
+      }
+    };
+    /// Variable selection to be tested
+    Gecode::IntVarBranch vb;
+    /// Index of variable that must be selected
+    int sel;
+  public:
+    /// Initialize test with name \a s, selection \a vb0, and expected \a s0
+    Activity(const std::string& s, Gecode::IntVarBranch vb0, int s0)
+      : Test::Base("Activity::"+s), vb(vb0), sel(s0) {}
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* s = new TestSpace(vb);
+      // Start recording: all variables are considered by the selection
+      (void) s->status();
+      delete s->choice();
+      // Modify x[1] three times and x[2] once
+      s->modify(1); s->modify(1); s->modify(1);
+      s->modify(2);
+      // Activity is shared with clones
+      TestSpace* c = static_cast<TestSpace*>(s->clone());
+      delete s;
+      // Commit to the first alternative: the selected variable is assigned
+      (void) c->status();
+      const Gecode::Choice* ch = c->choice();
+      c->commit(*ch,0);
+      delete ch;
+      (void) c->status();
+      bool ok = true;
+      for (int i=0; i<3; i++)
+        if (c->x[i].assigned() != (i == sel))
+          ok = false;
+      delete c;
+      return ok;
+    }
+  };
+
+  Activity a_min("Min",Gecode::INT_VAR_ACTIVITY_MIN,0);
+  Activity a_max("Max",Gecode::INT_VAR_ACTIVITY_MAX,1);
+
+}
+
+#endif
+
+// STATISTICS: test-kernel
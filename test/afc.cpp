@@ -62,11 +62,32 @@ namespace Test {
       void post(void) {
         Gecode::rel(*this, x, Gecode::IRT_LE, y);
       }
+      /// Post propagators that fail
+      void conflict(void) {
+        Gecode::rel(*this, x, Gecode::IRT_LE, y);
+        Gecode::rel(*this, x, Gecode::IRT_GR, y);
+      }
+      /// Fail the propagator posted by post() in a clone
+      bool fail(void) {
+        (void) status();
+        TestSpace* c = static_cast<TestSpace*>(clone());
+        Gecode::rel(*c, c->x, Gecode::IRT_EQ, 5);
+        Gecode::rel(*c, c->y, Gecode::IRT_EQ, 5);
+        bool f = (c->status() == Gecode::SS_FAILED);
+        delete c;
+        return f;
+      }
+      /// Return AFC of \a x
+      double afc(void) const {
+        return x.afc();
+      }
       /// Copy during cloning
       virtual Space* copy(bool share) {
         return new TestSpace(share,*this);
       }
     };
+    /// Decay factor to be used
+    double d;
     /// How many test operations to be performed
     static const int n_ops = 8 * 1024;
     /// How many spaces to maintain
@@ -83,21 +104,41 @@ namespace Test {
       return rand(n);
     }
   public:
-    /// Initialize test
-    AFC(void) : Test::Base("AFC") {}
+    /// Initialize test with name \a s and decay factor \a d0
+    AFC(const std::string& s, double d0) : Test::Base(s), d(d0) {}
     /// Perform actual tests
     bool run(void) {
       // Array of spaces for tests
       TestSpace* s[n];
       // How many spaces exist in s
       int n_s = 1;
+
+      // Fail a single propagator and check its AFC with decay
+      {
+        TestSpace* t = new TestSpace;
+        t->afc_decay(d);
+        t->post();
+        // A new propagator counts as failed once
+        double a = 1.0, inc = 1.0;
+        for (int i=0; i<4; i++) {
+          if (!t->fail()) {
+            delete t; return false;
+          }
+          a += inc; inc /= d;
+        }
+        bool ok = (t->afc() == a);
+        delete t;
+        if (!ok)
+          return false;
+      }
       
       for (int i=n; i--; )
         s[i] = NULL;
       s[0] = new TestSpace;
+      s[0]->afc_decay(d);
 
       for (int o=n_ops; o--; )
-        switch (rand(3)) {
+        switch (rand(4)) {
         case 0:
           // clone space
           {
@@ -126,6 +167,16 @@ namespace Test {
           // post propagator
           s[space(s)]->post();
           break;
+        case 3:
+          // fail space
+          if (n_s > 1) {
+            int i = space(s);
+            s[i]->conflict();
+            if (s[i]->status() != Gecode::SS_FAILED)
+              return false;
+            delete s[i]; s[i]=NULL; n_s--;
+          }
+          break;
         default:
           GECODE_NEVER;
         }
@@ -136,7 +187,8 @@ namespace Test {
     }
   };
 
-  AFC afc;
+  AFC afc("AFC::Plain",1.0);
+  AFC afc_decay("AFC::Decay",0.5);
 
 }
 
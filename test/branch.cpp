@@ -131,6 +131,10 @@ namespace Test { namespace Branch {
     Gecode::INT_VAR_DEGREE_MAX,
     Gecode::INT_VAR_AFC_MIN,
     Gecode::INT_VAR_AFC_MAX,
+#ifdef GECODE_HAS_ACTIVITY
+    Gecode::INT_VAR_ACTIVITY_MIN,
+    Gecode::INT_VAR_ACTIVITY_MAX,
+#endif
     Gecode::INT_VAR_MIN_MIN,
     Gecode::INT_VAR_MIN_MAX,
     Gecode::INT_VAR_MAX_MIN,
@@ -141,6 +145,10 @@ namespace Test { namespace Branch {
     Gecode::INT_VAR_SIZE_DEGREE_MAX,
     Gecode::INT_VAR_SIZE_AFC_MIN,
     Gecode::INT_VAR_SIZE_AFC_MAX,
+#ifdef GECODE_HAS_ACTIVITY
+    Gecode::INT_VAR_SIZE_ACTIVITY_MIN,
+    Gecode::INT_VAR_SIZE_ACTIVITY_MAX,
+#endif
     Gecode::INT_VAR_REGRET_MIN_MIN,
     Gecode::INT_VAR_REGRET_MIN_MAX,
     Gecode::INT_VAR_REGRET_MAX_MIN,
@@ -158,6 +166,10 @@ namespace Test { namespace Branch {
     "INT_VAR_DEGREE_MAX",
     "INT_VAR_AFC_MIN",
     "INT_VAR_AFC_MAX",
+#ifdef GECODE_HAS_ACTIVITY
+    "INT_VAR_ACTIVITY_MIN",
+    "INT_VAR_ACTIVITY_MAX",
+#endif
     "INT_VAR_MIN_MIN",
     "INT_VAR_MIN_MAX",
     "INT_VAR_MAX_MIN",
@@ -168,6 +180,10 @@ namespace Test { namespace Branch {
     "INT_VAR_SIZE_DEGREE_MAX",
     "INT_VAR_SIZE_AFC_MIN",
     "INT_VAR_SIZE_AFC_MAX",
+#ifdef GECODE_HAS_ACTIVITY
+    "INT_VAR_SIZE_ACTIVITY_MIN",
+    "INT_VAR_SIZE_ACTIVITY_MAX",
+#endif
     "INT_VAR_REGRET_MIN_MIN",
     "INT_VAR_REGRET_MIN_MAX",
     "INT_VAR_REGRET_MAX_MIN",
@@ -219,6 +235,10 @@ namespace Test { namespace Branch {
     Gecode::SET_VAR_DEGREE_MAX,
     Gecode::SET_VAR_AFC_MIN,
     Gecode::SET_VAR_AFC_MAX,
+#ifdef GECODE_HAS_ACTIVITY
+    Gecode::SET_VAR_ACTIVITY_MIN,
+    Gecode::SET_VAR_ACTIVITY_MAX,
+#endif
     Gecode::SET_VAR_MIN_MIN,
     Gecode::SET_VAR_MIN_MAX,
     Gecode::SET_VAR_MAX_MIN,
@@ -228,7 +248,11 @@ namespace Test { namespace Branch {
     Gecode::SET_VAR_SIZE_DEGREE_MIN,
     Gecode::SET_VAR_SIZE_DEGREE_MAX,
     Gecode::SET_VAR_SIZE_AFC_MIN,
-    Gecode::SET_VAR_SIZE_AFC_MAX
+    Gecode::SET_VAR_SIZE_AFC_MAX,
+#ifdef GECODE_HAS_ACTIVITY
+    Gecode::SET_VAR_SIZE_ACTIVITY_MIN,
+    Gecode::SET_VAR_SIZE_ACTIVITY_MAX,
+#endif
   };
   /// Number of set variable selections
   const int n_set_var_branch =
@@ -242,6 +266,10 @@ namespace Test { namespace Branch {
     "SET_VAR_DEGREE_MAX",
     "SET_VAR_AFC_MIN",
     "SET_VAR_AFC_MAX",
+#ifdef GECODE_HAS_ACTIVITY
+    "SET_VAR_ACTIVITY_MIN",
+    "SET_VAR_ACTIVITY_MAX",
+#endif
     "SET_VAR_MIN_MIN",
     "SET_VAR_MIN_MAX",
     "SET_VAR_MAX_MIN",
@@ -251,7 +279,11 @@ namespace Test { namespace Branch {
     "SET_VAR_SIZE_DEGREE_MIN",
     "SET_VAR_SIZE_DEGREE_MAX",
     "SET_VAR_SIZE_AFC_MIN",
-    "SET_VAR_SIZE_AFC_MAX"
+    "SET_VAR_SIZE_AFC_MAX",
+#ifdef GECODE_HAS_ACTIVITY
+    "SET_VAR_SIZE_ACTIVITY_MIN",
+    "SET_VAR_SIZE_ACTIVITY_MAX",
+#endif
   };
   /// Set value selections
   const Gecode::SetValBranch set_val_branch[] = {
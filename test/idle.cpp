@@ -0,0 +1,137 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for deferring idle propagators
+  class Idle : public Test::Base {
+  protected:
+    /// Number of variables
+    static const int n = 6;
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Integer variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      TestSpace(unsigned int l) : x(*this,n,0,n+1) {
+        idle_limit(l);
+        // Expensive propagators which are deferred when idle
+        Gecode::distinct(*this, x, Gecode::ICL_DOM);
+        Gecode::linear(*this, x, Gecode::IRT_LQ, n*(n+1)/2+2,
+                       Gecode::ICL_DOM);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+      /// Post relation \a r between variable \a i and value \a v
+      void post(int i, Gecode::IntRelType r, int v) {
+        Gecode::rel(*this, x[i], r, v);
+      }
+      /// Test whether all variables are assigned
+      bool assigned(void) const {
+        for (int i=n; i--; )
+          if (!x[i].assigned())
+            return false;
+        return true;
+      }
+      /// Test whether \a s has the same domains
+      bool same(TestSpace& s) {
+        for (int i=n; i--; ) {
+          Gecode::IntVarRanges r(x[i]), q(s.x[i]);
+          if (!Gecode::Iter::Ranges::equal(r,q))
+            return false;
+        }
+        return true;
+      }
+    };
+    /// Number of relations to post
+    static const int n_ops = 64;
+    /// Idle limit to be tested
+    unsigned int l;
+  public:
+    /// Initialize test with name \a s and idle limit \a l0
+    Idle(const std::string& s, unsigned int l0)
+      : Test::Base("Idle::"+s), l(l0) {}
+    /// Perform actual tests
+    bool run(void) {
+      // Reference space without deferral
+      TestSpace* r = new TestSpace(0);
+      // Space deferring idle propagators
+      TestSpace* d = new TestSpace(l);
+      bool ok = true;
+      for (int o=n_ops; o--; ) {
+        Gecode::SpaceStatus sr = r->status();
+        Gecode::SpaceStatus sd = d->status();
+        // Deferred propagators must have run at fixpoint
+        if ((sr != sd) || ((sr != Gecode::SS_FAILED) && !r->same(*d))) {
+          ok = false; break;
+        }
+        if ((sr == Gecode::SS_FAILED) || r->assigned())
+          break;
+        int i = rand(n);
+        Gecode::IntRelType ir;
+        switch (rand(3)) {
+        case 0:  ir = Gecode::IRT_NQ; break;
+        case 1:  ir = Gecode::IRT_LQ; break;
+        default: ir = Gecode::IRT_GQ; break;
+        }
+        int v = rand(n+2);
+        r->post(i,ir,v); d->post(i,ir,v);
+      }
+      delete r; delete d;
+      return ok;
+    }
+  };
+
+  Idle idle_1("1",1);
+  Idle idle_2("2",2);
+  Idle idle_8("8",8);
+
+}
+
+// STATISTICS: test-kernel
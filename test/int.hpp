@@ -173,6 +173,8 @@ namespace Test { namespace Int {
     switch (epk) {
     case EPK_MEMORY: return "Memory";
     case EPK_SPEED:  return "Speed";
+    case EPK_COMPACT: return "Compact";
+    case EPK_MDD: return "MDD";
     default: return "Def";
     }
   }
@@ -479,6 +479,43 @@ namespace Test { namespace Int {
 
 
 
+     /// %Test with large tuple set (several hundred tuples)
+     class TupleSetLarge : public Test {
+     protected:
+       /// Extensional propagation kind
+       Gecode::ExtensionalPropKind epk;
+       /// Test whether \a x0 to \a x4 form a tuple
+       static bool tuple(int x0, int x1, int x2, int x3, int x4) {
+         return ((17*x0 + 29*x1 + 37*x2 + 53*x3 + 71*x4 + 
+                  x0*x2 + x1*x3*x4) % 7) == 0;
+       }
+     public:
+       /// Create and register test
+       TupleSetLarge(Gecode::ExtensionalPropKind epk0)
+         : Test("Extensional::TupleSet::Large::"+str(epk0),
+                5,0,4,false,Gecode::ICL_DOM), epk(epk0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return tuple(x[0],x[1],x[2],x[3],x[4]);
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         TupleSet t;
+         for (int x0=0; x0<=4; x0++)
+           for (int x1=0; x1<=4; x1++)
+             for (int x2=0; x2<=4; x2++)
+               for (int x3=0; x3<=4; x3++)
+                 for (int x4=0; x4<=4; x4++)
+                   if (tuple(x0,x1,x2,x3,x4)) {
+                     IntArgs ia(5, x0,x1,x2,x3,x4);
+                     t.add(ia);
+                   }
+         t.finalize();
+         extensional(home, x, t, epk, ICL_DEF);
+       }
+     };
+
      /// %Test with bool tuple set
      class TupleSetBool : public Test {
        mutable Gecode::TupleSet t;
@@ -555,12 +592,23 @@ namespace Test { namespace Int {
 
      TupleSetA tsam(Gecode::EPK_MEMORY);
      TupleSetA tsas(Gecode::EPK_SPEED);
+     TupleSetA tsac(Gecode::EPK_COMPACT);
+     TupleSetA tsamdd(Gecode::EPK_MDD);
 
      TupleSetB tsbm(Gecode::EPK_MEMORY);
      TupleSetB tsbs(Gecode::EPK_SPEED);
+     TupleSetB tsbc(Gecode::EPK_COMPACT);
+     TupleSetB tsbmdd(Gecode::EPK_MDD);
 
      TupleSetBool tsboolm(Gecode::EPK_MEMORY, 0.3);
      TupleSetBool tsbools(Gecode::EPK_SPEED, 0.3);
+     TupleSetBool tsboolc(Gecode::EPK_COMPACT, 0.3);
+     TupleSetBool tsboolmdd(Gecode::EPK_MDD, 0.3);
+
+     TupleSetLarge tslm(Gecode::EPK_MEMORY);
+     TupleSetLarge tsls(Gecode::EPK_SPEED);
+     TupleSetLarge tslc(Gecode::EPK_COMPACT);
+     TupleSetLarge tslmdd(Gecode::EPK_MDD);
      //@}
 
    }
@@ -0,0 +1,145 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for the global heap chunk pool
+  class HeapChunkPool : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    protected:
+      /// Integer variables (to require several heap chunks)
+      Gecode::IntVarArray x;
+    public:
+      /// Constructor for creation
+      TestSpace(void) : x(*this,n_x,0,10) {}
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+    };
+    /// Number of variables per space
+    static const int n_x = 4 * 1024;
+    /// Number of spaces created by a single round
+    static const int n_s = 16;
+    /// Create and delete spaces, each with their own shared memory
+    static void round(void) {
+      TestSpace* s[n_s];
+      s[0] = new TestSpace;
+      for (int i=1; i<n_s; i++)
+        s[i] = static_cast<TestSpace*>(s[i-1]->clone(false));
+      for (int i=n_s; i--; )
+        delete s[i];
+    }
+    /// Total number of requests in \a s
+    static unsigned long int total(const Gecode::HeapChunkStatistics& s) {
+      return s.hit + s.pool + s.miss;
+    }
+#ifdef GECODE_HAS_THREADS
+    /// Thread performing rounds
+    class Round : public Gecode::Support::Runnable {
+    protected:
+      /// Number of rounds
+      int n;
+      /// Event to signal when done
+      Gecode::Support::Event& e;
+    public:
+      /// Initialize with \a n0 rounds and event \a e0
+      Round(int n0, Gecode::Support::Event& e0) : n(n0), e(e0) {}
+      /// Perform rounds
+      virtual void run(void) {
+        for (int i=n; i--; )
+          round();
+        e.signal();
+      }
+    };
+#endif
+    /// Number of threads
+    int n_t;
+    /// Number of rounds per thread
+    static const int n_r = 8;
+  public:
+    /// Initialize test with name \a s for \a t threads
+    HeapChunkPool(const std::string& s, int t)
+      : Test::Base("HeapChunkPool::"+s), n_t(t) {}
+    /// Perform actual tests
+    bool run(void) {
+      Gecode::HeapChunkStatistics s0 = Gecode::hcpool.statistics();
+      if (n_t == 1) {
+        for (int i=n_r; i--; )
+          round();
+      } else {
+#ifdef GECODE_HAS_THREADS
+        Gecode::Support::Event* e = new Gecode::Support::Event[n_t];
+        for (int i=n_t; i--; )
+          Gecode::Support::Thread::run(new Round(n_r,e[i]));
+        for (int i=n_t; i--; )
+          e[i].wait();
+        delete [] e;
+#endif
+      }
+      Gecode::HeapChunkStatistics s1 = Gecode::hcpool.statistics();
+      // All requests must have been recorded
+      if (total(s1) < total(s0) + static_cast<unsigned long int>
+          (n_t * n_r * n_s))
+        return false;
+      // Without contention, new shared memory objects must reuse chunks
+      if ((n_t == 1) && (s1.pool == s0.pool))
+        return false;
+      return true;
+    }
+  };
+
+  HeapChunkPool hcpool_1("Sequential",1);
+#ifdef GECODE_HAS_THREADS
+  HeapChunkPool hcpool_2("Threads::2",2);
+  HeapChunkPool hcpool_4("Threads::4",4);
+#endif
+
+}
+
+// STATISTICS: test-kernel
@@ -74,10 +74,10 @@ namespace Test { namespace Int {
       ManFixPCumulative(int c0, 
                        const Gecode::IntArgs& p0,
                        const Gecode::IntArgs& u0,
-                       int o0)
-        : Test("Scheduling::Cumulative::Man::Fix::"+str(o0)+"::"+
+                       int o0, Gecode::IntConLevel icl0)
+        : Test("Scheduling::Cumulative::Man::Fix::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(p0)+"::"+str(u0),
-               p0.size(),o0,o0+st(c0,p0,u0)), 
+               p0.size(),o0,o0+st(c0,p0,u0),false,icl0), 
           c(c0), p(p0), u(u0), o(o0) {
         testsearch = false;
         testfix = false;
@@ -125,7 +125,7 @@ namespace Test { namespace Int {
       }
       /// Post constraint on \a x
       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
-        Gecode::cumulative(home, c, x, p, u);
+        Gecode::cumulative(home, c, x, p, u, icl);
       }
     };
 
@@ -156,10 +156,10 @@ namespace Test { namespace Int {
       OptFixPCumulative(int c0, 
                        const Gecode::IntArgs& p0,
                        const Gecode::IntArgs& u0,
-                       int o0)
-        : Test("Scheduling::Cumulative::Opt::Fix::"+str(o0)+"::"+
+                       int o0, Gecode::IntConLevel icl0)
+        : Test("Scheduling::Cumulative::Opt::Fix::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(p0)+"::"+str(u0),
-               2*p0.size(),o0,o0+st(c0,p0,u0)), 
+               2*p0.size(),o0,o0+st(c0,p0,u0),false,icl0), 
           c(c0), p(p0), u(u0), l(o0+st(c,p,u)/2), o(o0) {
         testsearch = false;
         testfix = false;
@@ -218,7 +218,7 @@ namespace Test { namespace Int {
           s[i]=x[i];
           m[i]=Gecode::expr(home, x[n+i] > l);
         }
-        Gecode::cumulative(home, c, s, p, u, m);
+        Gecode::cumulative(home, c, s, p, u, m, icl);
       }
     };
 
@@ -246,10 +246,10 @@ namespace Test { namespace Int {
       /// Create and register test
       ManFlexCumulative(int c0, int minP, int maxP,
                        const Gecode::IntArgs& u0,
-                       int o0)
-        : Test("Scheduling::Cumulative::Man::Flex::"+str(o0)+"::"+
+                       int o0, Gecode::IntConLevel icl0)
+        : Test("Scheduling::Cumulative::Man::Flex::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(minP)+"::"+str(maxP)+"::"+str(u0),
-               2*u0.size(),0,std::max(maxP,st(c0,maxP,u0))), 
+               2*u0.size(),0,std::max(maxP,st(c0,maxP,u0)),false,icl0), 
           c(c0), _minP(minP), _maxP(maxP), u(u0), o(o0) {
         testsearch = false;
         testfix = false;
@@ -310,7 +310,7 @@ namespace Test { namespace Int {
           rel(home, _minP <= px[i]);
           rel(home, _maxP >= px[i]);
         }
-        Gecode::cumulative(home, c, s, px, e, u);
+        Gecode::cumulative(home, c, s, px, e, u, icl);
       }
     };
 
@@ -340,10 +340,10 @@ namespace Test { namespace Int {
       /// Create and register test
       OptFlexCumulative(int c0, int minP, int maxP,
                         const Gecode::IntArgs& u0,
-                        int o0)
-        : Test("Scheduling::Cumulative::Opt::Flex::"+str(o0)+"::"+
+                        int o0, Gecode::IntConLevel icl0)
+        : Test("Scheduling::Cumulative::Opt::Flex::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(minP)+"::"+str(maxP)+"::"+str(u0),
-               3*u0.size(),0,std::max(maxP,st(c0,maxP,u0))), 
+               3*u0.size(),0,std::max(maxP,st(c0,maxP,u0)),false,icl0), 
           c(c0), _minP(minP), _maxP(maxP), u(u0), 
           l(std::max(maxP,st(c0,maxP,u0))/2), o(o0) {
         testsearch = false;
@@ -411,7 +411,7 @@ namespace Test { namespace Int {
         Gecode::BoolVarArgs m(n);
         for (int i=0; i<n; i++)
           m[i]=Gecode::expr(home, (x[n+i] > l));
-        Gecode::cumulative(home, c, s, px, e, u, m);
+        Gecode::cumulative(home, c, s, px, e, u, m, icl);
       }
     };
 
@@ -430,56 +430,60 @@ namespace Test { namespace Int {
         IntArgs u2(4, 2,2,2,2);
         IntArgs u3(4, 2,3,4,5);
 
-        for (int c=1; c<8; c++) {
-          int off = 0;
-          for (int coff=0; coff<2; coff++) {
-            (void) new ManFixPCumulative(c,p1,u1,off);
-            (void) new ManFixPCumulative(c,p1,u2,off);
-            (void) new ManFixPCumulative(c,p1,u3,off);
-            (void) new ManFixPCumulative(c,p2,u1,off);
-            (void) new ManFixPCumulative(c,p2,u2,off);
-            (void) new ManFixPCumulative(c,p2,u3,off);
-            (void) new ManFixPCumulative(c,p3,u1,off);
-            (void) new ManFixPCumulative(c,p3,u2,off);
-            (void) new ManFixPCumulative(c,p3,u3,off);
-            (void) new ManFixPCumulative(c,p4,u1,off);
-            (void) new ManFixPCumulative(c,p4,u2,off);
-            (void) new ManFixPCumulative(c,p4,u3,off);
+        IntConLevel icls[] = {ICL_DEF, ICL_DOM};
+        for (int i=0; i<2; i++) {
+          IntConLevel icl = icls[i];
+          for (int c=1; c<8; c++) {
+            int off = 0;
+            for (int coff=0; coff<2; coff++) {
+              (void) new ManFixPCumulative(c,p1,u1,off,icl);
+              (void) new ManFixPCumulative(c,p1,u2,off,icl);
+              (void) new ManFixPCumulative(c,p1,u3,off,icl);
+              (void) new ManFixPCumulative(c,p2,u1,off,icl);
+              (void) new ManFixPCumulative(c,p2,u2,off,icl);
+              (void) new ManFixPCumulative(c,p2,u3,off,icl);
+              (void) new ManFixPCumulative(c,p3,u1,off,icl);
+              (void) new ManFixPCumulative(c,p3,u2,off,icl);
+              (void) new ManFixPCumulative(c,p3,u3,off,icl);
+              (void) new ManFixPCumulative(c,p4,u1,off,icl);
+              (void) new ManFixPCumulative(c,p4,u2,off,icl);
+              (void) new ManFixPCumulative(c,p4,u3,off,icl);
 
-            (void) new ManFlexCumulative(c,0,1,u1,off);
-            (void) new ManFlexCumulative(c,0,1,u2,off);
-            (void) new ManFlexCumulative(c,0,1,u3,off);
-            (void) new ManFlexCumulative(c,0,2,u1,off);
-            (void) new ManFlexCumulative(c,0,2,u2,off);
-            (void) new ManFlexCumulative(c,0,2,u3,off);
-            (void) new ManFlexCumulative(c,3,5,u1,off);
-            (void) new ManFlexCumulative(c,3,5,u2,off);
-            (void) new ManFlexCumulative(c,3,5,u3,off);
+              (void) new ManFlexCumulative(c,0,1,u1,off,icl);
+              (void) new ManFlexCumulative(c,0,1,u2,off,icl);
+              (void) new ManFlexCumulative(c,0,1,u3,off,icl);
+              (void) new ManFlexCumulative(c,0,2,u1,off,icl);
+              (void) new ManFlexCumulative(c,0,2,u2,off,icl);
+              (void) new ManFlexCumulative(c,0,2,u3,off,icl);
+              (void) new ManFlexCumulative(c,3,5,u1,off,icl);
+              (void) new ManFlexCumulative(c,3,5,u2,off,icl);
+              (void) new ManFlexCumulative(c,3,5,u3,off,icl);
 
-            (void) new OptFixPCumulative(c,p1,u1,off);
-            (void) new OptFixPCumulative(c,p1,u2,off);
-            (void) new OptFixPCumulative(c,p1,u3,off);
-            (void) new OptFixPCumulative(c,p2,u1,off);
-            (void) new OptFixPCumulative(c,p2,u2,off);
-            (void) new OptFixPCumulative(c,p2,u3,off);
-            (void) new OptFixPCumulative(c,p3,u1,off);
-            (void) new OptFixPCumulative(c,p3,u2,off);
-            (void) new OptFixPCumulative(c,p3,u3,off);
-            (void) new OptFixPCumulative(c,p4,u1,off);
-            (void) new OptFixPCumulative(c,p4,u2,off);
-            (void) new OptFixPCumulative(c,p4,u3,off);
+              (void) new OptFixPCumulative(c,p1,u1,off,icl);
+              (void) new OptFixPCumulative(c,p1,u2,off,icl);
+              (void) new OptFixPCumulative(c,p1,u3,off,icl);
+              (void) new OptFixPCumulative(c,p2,u1,off,icl);
+              (void) new OptFixPCumulative(c,p2,u2,off,icl);
+              (void) new OptFixPCumulative(c,p2,u3,off,icl);
+              (void) new OptFixPCumulative(c,p3,u1,off,icl);
+              (void) new OptFixPCumulative(c,p3,u2,off,icl);
+              (void) new OptFixPCumulative(c,p3,u3,off,icl);
+              (void) new OptFixPCumulative(c,p4,u1,off,icl);
+              (void) new OptFixPCumulative(c,p4,u2,off,icl);
+              (void) new OptFixPCumulative(c,p4,u3,off,icl);
             
-            (void) new OptFlexCumulative(c,0,1,u1,off);
-            (void) new OptFlexCumulative(c,0,1,u2,off);
-            (void) new OptFlexCumulative(c,0,1,u3,off);
-            (void) new OptFlexCumulative(c,0,2,u1,off);
-            (void) new OptFlexCumulative(c,0,2,u2,off);
-            (void) new OptFlexCumulative(c,0,2,u3,off);
-            (void) new OptFlexCumulative(c,3,5,u1,off);
-            (void) new OptFlexCumulative(c,3,5,u2,off);
-            (void) new OptFlexCumulative(c,3,5,u3,off);
+              (void) new OptFlexCumulative(c,0,1,u1,off,icl);
+              (void) new OptFlexCumulative(c,0,1,u2,off,icl);
+              (void) new OptFlexCumulative(c,0,1,u3,off,icl);
+              (void) new OptFlexCumulative(c,0,2,u1,off,icl);
+              (void) new OptFlexCumulative(c,0,2,u2,off,icl);
+              (void) new OptFlexCumulative(c,0,2,u3,off,icl);
+              (void) new OptFlexCumulative(c,3,5,u1,off,icl);
+              (void) new OptFlexCumulative(c,3,5,u2,off,icl);
+              (void) new OptFlexCumulative(c,3,5,u3,off,icl);
 
-            off = Gecode::Int::Limits::min;
+              off = Gecode::Int::Limits::min;
+            }
           }
         }
       }
@@ -37,6 +37,7 @@
 
 #include <gecode/minimodel.hh>
 #include <gecode/search.hh>
+#include <climits>
 
 #include "test/test.hh"
 
@@ -335,6 +336,402 @@ namespace Test {
       }
     };
 
+    /// %Test for limited discrepancy search
+    template<class Model>
+    class LDS : public Test {
+    private:
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Adaptive recomputation distance
+      unsigned int a_d;
+    public:
+      /// Initialize test
+      LDS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int c_d0, unsigned int a_d0)
+        : Test("LDS::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(a_d0),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.a_d = a_d;
+        // Large enough to explore the entire search tree
+        o.d_l = 100;
+        o.stop = &f;
+        Gecode::LDS<Model> lds(m,o);
+        int n = m->solutions();
+        delete m;
+        while (true) {
+          Model* s = lds.next();
+          if (s != NULL) {
+            n--; delete s;
+          }
+          if ((s == NULL) && !lds.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        return n == 0;
+      }
+    };
+
+    /// %Test for portfolio search returning the first solution
+    template<class Model>
+    class First : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      First(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+            unsigned int t0)
+        : Test("PBS::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::Options o;
+        o.threads = t;
+        Gecode::Search::Asset a[2];
+        a[0] = Gecode::Search::Asset(Gecode::Search::AE_DFS,o);
+        a[1] = Gecode::Search::Asset(Gecode::Search::AE_LDS,o);
+        Gecode::PBS<Model> pbs(m,a,2);
+        bool s = (m->solutions() > 0);
+        delete m;
+        Model* f = pbs.next();
+        bool ok = ((f != NULL) == s) && (pbs.next() == NULL);
+        delete f;
+        return ok;
+      }
+    };
+
+    /// Space whose only solution requires two discrepancies
+    class DeepSolution : public Space {
+    public:
+      /// Variables used
+      IntVarArray x;
+      /// Fail unless the first two variables are one and all others zero
+      static void check(Space& home) {
+        DeepSolution& d = static_cast<DeepSolution&>(home);
+        for (int i=d.x.size(); i--; )
+          if (d.x[i].val() != ((i < 2) ? 1 : 0)) {
+            home.fail(); return;
+          }
+      }
+      /// Constructor for space creation with \a n variables
+      DeepSolution(int n=14) : x(*this,n,0,1) {
+        // The solution is only recognized when all variables are assigned
+        wait(*this, x, &check);
+        branch(*this, x, INT_VAR_NONE, INT_VAL_MIN);
+      }
+      /// Constructor for cloning \a s
+      DeepSolution(bool share, DeepSolution& s) : Space(share,s) {
+        x.update(*this, share, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new DeepSolution(share,*this);
+      }
+      /// Add constraint for next better solution (there is only one)
+      virtual void constrain(const Space&) {
+      }
+    };
+
+    /// %Test for portfolio search with an incomplete asset
+    class Incomplete : public Base {
+    public:
+      /// Initialize test
+      Incomplete(void) : Base("Search::PBS::Incomplete") {}
+      /// Run test
+      virtual bool run(void) {
+        DeepSolution* m = new DeepSolution;
+        // The LDS asset is exhausted long before DFS finds the solution
+        Gecode::Search::Options o;
+        o.d_l = 1;
+        Gecode::Search::Asset a[2];
+        a[0] = Gecode::Search::Asset(Gecode::Search::AE_DFS);
+        a[1] = Gecode::Search::Asset(Gecode::Search::AE_LDS,o);
+        Gecode::PBS<DeepSolution> pbs(m,a,2);
+        delete m;
+        DeepSolution* s = pbs.next();
+        bool ok = (s != NULL) && (pbs.next() == NULL) && !pbs.stopped();
+        delete s;
+        return ok;
+      }
+    };
+
+    /// %Test for search engines with a memory limit
+    template<template<class> class Engine>
+    class MemoryLimit : public Base {
+    private:
+      /// Whether the engine searches for a best solution
+      bool b;
+      /// Number of threads
+      unsigned int t;
+      /// Return search options with memory limit \a l
+      Gecode::Search::Options options(size_t l) const {
+        Gecode::Search::Options o;
+        o.c_d = 1;
+        o.a_d = 2;
+        o.d_l = 100;
+        o.threads = t;
+        o.memory_limit = l;
+        return o;
+      }
+      /// Return peak memory when exploring with memory limit \a l
+      size_t memory(size_t l) const {
+        DeepSolution* m = new DeepSolution;
+        Engine<DeepSolution> e(m,options(l));
+        delete m;
+        while (DeepSolution* s = e.next())
+          delete s;
+        return e.statistics().memory;
+      }
+    public:
+      /// Initialize test for engine \a e, best solution \a b0, \a t0 threads
+      MemoryLimit(const std::string& e, bool b0, unsigned int t0)
+        : Base("Search::MemoryLimit::"+e+"::"+Test::str(t0)),
+          b(b0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        HasSolutions* m = new HasSolutions(HTB_BINARY,HTB_BINARY,HTB_BINARY,
+                                           b ? HTC_LEX_LE : HTC_NONE);
+        int n = m->solutions();
+        // The limit is reached by the first clone
+        Engine<HasSolutions> e(m,options(1));
+        delete m;
+        HasSolutions* l = NULL;
+        while (HasSolutions* s = e.next()) {
+          n--; delete l; l = s;
+        }
+        bool ok = b ? ((l != NULL) && l->best()) : (n == 0);
+        delete l;
+        // Search creates fewer clones with a memory limit
+        return ok && (memory(1) < memory(0));
+      }
+    };
+
+    /// Sink recording the solutions of HasSolutions
+    class RecordSink : public Gecode::Search::Sink {
+    public:
+      /// Maximal number of solutions
+      static const int n_max = 8;
+      /// Number of solutions recorded
+      int n;
+      /// Values of the variables of all solutions
+      int v[n_max][6];
+      /// Whether more than the maximal number of solutions arrived
+      bool overflow;
+      /// Initialize
+      RecordSink(void) : n(0), overflow(false) {}
+      /// Record solution \a s
+      virtual void solution(const Space& s) {
+        const HasSolutions& h = static_cast<const HasSolutions&>(s);
+        if (n == n_max) {
+          overflow = true; return;
+        }
+        for (int i=6; i--; )
+          v[n][i] = h.x[i].val();
+        n++;
+      }
+      /// Compare solutions \a i and \a j lexicographically
+      int compare(int i, int j) const {
+        for (int k=0; k<6; k++)
+          if (v[i][k] != v[j][k])
+            return (v[i][k] < v[j][k]) ? -1 : 1;
+        return 0;
+      }
+    };
+
+    /// %Test for search engines passing solutions to a sink
+    template<template<class> class Engine>
+    class SinkTest : public Base {
+    private:
+      /// Whether the engine searches for a best solution
+      bool b;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test for engine \a e, best solution \a b0, \a t0 threads
+      SinkTest(const std::string& e, bool b0, unsigned int t0)
+        : Base("Search::Sink::"+e+"::"+Test::str(t0)), b(b0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        HasSolutions* m = new HasSolutions(HTB_BINARY,HTB_BINARY,HTB_BINARY,
+                                           b ? HTC_LEX_LE : HTC_NONE);
+        int n = m->solutions();
+        RecordSink r;
+        // Only used by restart-based search
+        Gecode::Search::CutoffLuby c(1);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.d_l = 100;
+        o.cutoff = &c;
+        o.sink = &r;
+        Engine<HasSolutions> e(m,o);
+        delete m;
+        // All solutions go to the sink
+        if ((e.next() != NULL) || r.overflow)
+          return false;
+        if (b) {
+          // Solutions must arrive in strictly improving order
+          for (int i=1; i<r.n; i++)
+            if (r.compare(i,i-1) >= 0)
+              return false;
+          static const int l[6] = {4,5,2,3,0,1};
+          if (r.n == 0)
+            return false;
+          for (int i=6; i--; )
+            if (r.v[r.n-1][i] != l[i])
+              return false;
+          return true;
+        } else {
+          // Every solution must arrive exactly once
+          if (r.n != n)
+            return false;
+          for (int i=0; i<r.n; i++)
+            for (int j=i+1; j<r.n; j++)
+              if (r.compare(i,j) == 0)
+                return false;
+          return true;
+        }
+      }
+    };
+
+    /// Space with Boolean variables of which exactly half are one
+    class HalfOnes : public Space {
+    public:
+      /// Number of variables
+      static const int n = 6;
+      /// Number of solutions
+      static const int n_s = 20;
+      /// Variables used
+      BoolVarArray x;
+      /// Constructor for space creation
+      HalfOnes(void) : x(*this,n,0,1) {
+        linear(*this, x, IRT_EQ, n/2);
+        branch(*this, x, INT_VAR_NONE, INT_VAL_MIN);
+      }
+      /// Constructor for cloning \a s
+      HalfOnes(bool share, HalfOnes& s) : Space(share,s) {
+        x.update(*this, share, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new HalfOnes(share,*this);
+      }
+      /// Exclude the solution \a s
+      virtual void constrain(const Space& _s) {
+        const HalfOnes& s = static_cast<const HalfOnes&>(_s);
+        BoolVarArgs z(n/2), o(n/2);
+        int n_z = 0, n_o = 0;
+        for (int i=0; i<n; i++)
+          if (s.x[i].val() == 0)
+            z[n_z++] = x[i];
+          else
+            o[n_o++] = x[i];
+        // At least one variable must take a different value
+        clause(*this, BOT_OR, z, o, 1);
+      }
+      /// Return solution as bit vector
+      int key(void) const {
+        int k = 0;
+        for (int i=n; i--; )
+          k = 2*k + x[i].val();
+        return k;
+      }
+    };
+
+    /// %Test that restart-based search with no-goods finds all solutions
+    class NoGoodsAll : public Base {
+    private:
+      /// Depth limit for no-goods
+      unsigned int l;
+    public:
+      /// Initialize test with depth limit \a l0
+      NoGoodsAll(unsigned int l0)
+        : Base("Search::RBS::NoGoods::All::"+Test::str(l0)), l(l0) {}
+      /// Run test
+      virtual bool run(void) {
+        HalfOnes* m = new HalfOnes;
+        // Only to prevent non-termination
+        Gecode::Search::NodeStop ns(100000);
+        Gecode::Search::CutoffLuby c(1);
+        Gecode::Search::Options o;
+        o.stop = &ns;
+        o.cutoff = &c;
+        o.nogoods_limit = l;
+        Gecode::RBS<HalfOnes> rbs(m,o);
+        delete m;
+        bool f[1 << HalfOnes::n];
+        for (int i=1 << HalfOnes::n; i--; )
+          f[i] = false;
+        int n = 0;
+        bool ok = true;
+        while (HalfOnes* s = rbs.next()) {
+          // Each solution must be found exactly once
+          if (f[s->key()])
+            ok = false;
+          f[s->key()] = true; n++;
+          delete s;
+        }
+        return ok && (n == HalfOnes::n_s) && !rbs.stopped();
+      }
+    };
+
+    /// %Test that no-goods prune subtrees explored before a restart
+    class NoGoodsPrune : public Base {
+    private:
+      /// Return whether restart-based search with depth limit \a l succeeds
+      static bool solve(unsigned int l) {
+        DeepSolution* m = new DeepSolution(8);
+        Gecode::Search::NodeStop ns(100000);
+        // Less than the number of failures before the solution
+        Gecode::Search::CutoffConstant c(16);
+        Gecode::Search::Options o;
+        o.stop = &ns;
+        o.cutoff = &c;
+        o.nogoods_limit = l;
+        Gecode::RBS<DeepSolution> rbs(m,o);
+        delete m;
+        DeepSolution* s = rbs.next();
+        bool ok = (s != NULL);
+        delete s;
+        return ok;
+      }
+    public:
+      /// Initialize test
+      NoGoodsPrune(void) : Base("Search::RBS::NoGoods::Prune") {}
+      /// Run test
+      virtual bool run(void) {
+        // Without no-goods, every restart explores the same subtree
+        return !solve(0) && solve(8);
+      }
+    };
+
+    /// Portfolio of all best solution search engines
+    template<class T>
+    class BestPortfolio : public Gecode::PBS<T> {
+    private:
+      /// Return assets for options \a o
+      static const Gecode::Search::Asset* 
+      assets(const Gecode::Search::Options& o) {
+        static Gecode::Search::Asset a[3];
+        a[0] = Gecode::Search::Asset(Gecode::Search::AE_BAB,o);
+        a[1] = Gecode::Search::Asset(Gecode::Search::AE_RESTART,o);
+        a[2] = Gecode::Search::Asset(Gecode::Search::AE_RBS,o);
+        return a;
+      }
+    public:
+      /// Initialize portfolio for space \a s with options \a o
+      BestPortfolio(T* s, const Gecode::Search::Options& o)
+        : Gecode::PBS<T>(s,assets(o),3,o) {}
+    };
+
     /// %Test for best solution search
     template<class Model, template<class> class Engine>
     class Best : public Test {
@@ -358,11 +755,14 @@ namespace Test {
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
         Gecode::Search::FailStop f(2);
+        // Only used by restart-based search
+        Gecode::Search::CutoffLuby c(1);
         Gecode::Search::Options o;
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
         o.stop = &f;
+        o.cutoff = &c;
         Engine<Model> best(m,o);
         delete m;
         Model* b = NULL;
@@ -381,6 +781,66 @@ namespace Test {
       }
     };
 
+    /// %Test for geometric cutoff sequences
+    class Geometric : public Base {
+    public:
+      /// Initialize test
+      Geometric(void) : Base("Search::Cutoff::Geometric") {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::CutoffGeometric c(2,2.0);
+        if ((c() != 2) || (c() != 4) || (c() != 8))
+          return false;
+        // Values beyond the range of unsigned long int must be clamped
+        unsigned long int s = ULONG_MAX / 4 + 1;
+        Gecode::Search::CutoffGeometric l(s,4.0);
+        if ((l() != s) || (l() != ULONG_MAX) || (l() != ULONG_MAX))
+          return false;
+        // Bases not larger than one must be rejected
+        const double b[] = {1.0, 0.5, 0.0, -2.0};
+        for (int i=0; i<4; i++) {
+          try {
+            Gecode::Search::CutoffGeometric g(1,b[i]);
+            return false;
+          } catch (Gecode::Search::IllegalCutoff&) {}
+        }
+        // A scale of zero must be rejected
+        try {
+          Gecode::Search::CutoffGeometric g(0,2.0);
+          return false;
+        } catch (Gecode::Search::IllegalCutoff&) {}
+        return true;
+      }
+    };
+
+    /// %Test for constant and Luby cutoff sequences
+    class ConstantLuby : public Base {
+    public:
+      /// Initialize test
+      ConstantLuby(void) : Base("Search::Cutoff::ConstantLuby") {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::CutoffConstant c(3);
+        if ((c() != 3) || (c() != 3))
+          return false;
+        const unsigned long int luby[] = {1,1,2,1,1,2,4,1};
+        Gecode::Search::CutoffLuby l(2);
+        for (int i=0; i<8; i++)
+          if (l() != 2*luby[i])
+            return false;
+        // A scale of zero must be rejected
+        try {
+          Gecode::Search::CutoffConstant z(0);
+          return false;
+        } catch (Gecode::Search::IllegalCutoff&) {}
+        try {
+          Gecode::Search::CutoffLuby z(0);
+          return false;
+        } catch (Gecode::Search::IllegalCutoff&) {}
+        return true;
+      }
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -455,6 +915,28 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Limited discrepancy search
+        for (unsigned int c_d = 1; c_d<10; c_d++)
+          for (unsigned int a_d = 1; a_d<=c_d; a_d++) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new LDS<HasSolutions>(htb1.htb(),htb2.htb(),htb3.htb(),
+                                               c_d, a_d);
+            new LDS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, c_d, a_d);
+            new LDS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE, c_d, a_d);
+          }
+
+        // Portfolio search for first solution
+        for (unsigned int t = 1; t<=2; t++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3)
+                (void) new First<HasSolutions>(htb1.htb(),htb2.htb(),htb3.htb(),
+                                               t);
+          (void) new First<FailImmediate>(HTB_NONE,HTB_NONE,HTB_NONE,t);
+        }
+
         // Best solution search
         for (unsigned int t = 1; t<=4; t++)
           for (unsigned int c_d = 1; c_d<10; c_d++)
@@ -469,17 +951,54 @@ namespace Test {
                       (void) new Best<HasSolutions,Restart>
                         ("Restart",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
                          c_d,a_d,t);
+                      (void) new Best<HasSolutions,RBS>
+                        ("RBS",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                         c_d,a_d,t);
                   }
               (void) new Best<FailImmediate,BAB>
                 ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
               (void) new Best<HasSolutions,BAB>
                 ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
+              (void) new Best<FailImmediate,RBS>
+                ("RBS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
-        
+
+        // Portfolio search for best solutions: each asset runs in its
+        // own thread, hence only representative configurations
+        for (unsigned int t = 1; t<=2; t++) {
+          for (ConstrainTypes htc; htc(); ++htc)
+            for (BranchTypes htb; htb(); ++htb)
+              (void) new Best<HasSolutions,BestPortfolio>
+                ("PBS",htc.htc(),htb.htb(),htb.htb(),htb.htb(),4,2,t);
+          (void) new Best<FailImmediate,BestPortfolio>
+            ("PBS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,4,2,t);
+        }
+
       }
     };
 
     Create c;
+    Geometric g;
+    ConstantLuby cl;
+    Incomplete i;
+    NoGoodsAll nga_0(0);
+    NoGoodsAll nga_1(1);
+    NoGoodsAll nga_6(6);
+    NoGoodsPrune ngp;
+    MemoryLimit<Gecode::DFS> ml_dfs_1("DFS",false,1);
+    MemoryLimit<Gecode::DFS> ml_dfs_2("DFS",false,2);
+    MemoryLimit<Gecode::BAB> ml_bab_1("BAB",true,1);
+    MemoryLimit<Gecode::BAB> ml_bab_2("BAB",true,2);
+    MemoryLimit<Gecode::LDS> ml_lds_1("LDS",false,1);
+    SinkTest<Gecode::DFS> st_dfs_1("DFS",false,1);
+    SinkTest<Gecode::DFS> st_dfs_2("DFS",false,2);
+    SinkTest<Gecode::DFS> st_dfs_4("DFS",false,4);
+    SinkTest<Gecode::LDS> st_lds_1("LDS",false,1);
+    SinkTest<Gecode::BAB> st_bab_1("BAB",true,1);
+    SinkTest<Gecode::BAB> st_bab_2("BAB",true,2);
+    SinkTest<Gecode::BAB> st_bab_4("BAB",true,4);
+    SinkTest<Gecode::Restart> st_restart_1("Restart",true,1);
+    SinkTest<Gecode::RBS> st_rbs_1("RBS",true,1);
   }
 
 }
@@ -30,6 +30,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <map>
+#include <vector>
 #include <gecode/flatzinc.hh>
 #include <gecode/flatzinc/parser.hh>
 
@@ -42,16 +44,27 @@ struct FlatZincSpaceInfo {
   FlatZinc::FlatZincQuickxplainOptions& opt;
   Support::Timer& t_total;
   bool debug;
+  // number of satisfiability checks run concurrently
+  unsigned int jobs;
+  // cloning fg modifies it, hence clones must be created one at a time
+  Support::Mutex& m_clone;
+  // results of satisfiability checks, shared by all threads
+  map<set<int>,bool>& memo;
+  Support::Mutex& m_memo;
 };
 
 set<int> getConflicts(FlatZincSpaceInfo* s, set<int> fgc);
 set<int> quickxplain(FlatZincSpaceInfo* s, set<int> bgc, set<int> fgc);
 bool runSpace(FlatZincSpaceInfo* s, set<int> c);
+void runSpaces(FlatZincSpaceInfo* s, vector<set<int> >& c, 
+               vector<bool>& ret);
 int findFirstFailure(FlatZincSpaceInfo* s, set<int> bgc, 
                               set<int> fgc);
 int failureSearch(FlatZincSpaceInfo* s, FlatZinc::FlatZincSpace* fg,
                            FlatZinc::FlatZincSpace* fg0, set<int>* c,
                            int lo, int hi);
+int parallelFailureSearch(FlatZincSpaceInfo* s, set<int> bgc, 
+                          set<int> fgc);
 void printSet(set<int> s);
 
 int main(int argc, char** argv) {
@@ -94,9 +107,18 @@ int main(int argc, char** argv) {
 
     fg->createBranchers(fg->solveAnnotations(), false, std::cerr);
 
+    // number of concurrent satisfiability checks
+    unsigned int jobs = 1;
+#ifdef GECODE_HAS_THREADS
+    jobs = (opt.jobs() == 0) ? Support::Thread::npu() : opt.jobs();
+#endif
+    Support::Mutex m_clone, m_memo;
+    map<set<int>,bool> memo;
+
     // find and print out conflicts
-    FlatZincSpaceInfo s = {fg, p, opt, t_total, false}; // change to true
-                                                        // for debugging info
+    FlatZincSpaceInfo s = {fg, p, opt, t_total, false, // change to true
+                                                       // for debugging info
+                           jobs, m_clone, memo, m_memo};
     set<int> conflicts = getConflicts(&s, fgc);
 
     if (conflicts.size() > 0) {
@@ -211,8 +233,22 @@ set<int> quickxplain(FlatZincSpaceInfo* s, set<int> bgc, set<int> fgc) {
  *
  */
 bool runSpace(FlatZincSpaceInfo* s, set<int> c) {
+  // check whether the constraints have been checked before
+  s->m_memo.acquire();
+  map<set<int>,bool>::iterator m = s->memo.find(c);
+  if (m != s->memo.end()) {
+    bool ret = m->second;
+    s->m_memo.release();
+    return ret;
+  }
+  s->m_memo.release();
+
   // create a clone of fg to work on and post constraints
-  FlatZinc::FlatZincSpace* fg = (FlatZinc::FlatZincSpace*) s->fg->clone();
+  // (nothing is shared with fg if the clone is used by another thread)
+  s->m_clone.acquire();
+  FlatZinc::FlatZincSpace* fg = 
+    (FlatZinc::FlatZincSpace*) s->fg->clone(s->jobs == 1);
+  s->m_clone.release();
   fg->postStoredConstraints(c);
 
   bool ret = false;
@@ -231,15 +267,82 @@ bool runSpace(FlatZincSpaceInfo* s, set<int> c) {
 
   delete fg;
 
+  s->m_memo.acquire();
+  s->memo[c] = ret;
+  s->m_memo.release();
+
   return ret;
 }
 
+/**
+ * Satisfiability checks to be run concurrently.
+ *
+ */
+struct Checks {
+  // number of checks not yet finished
+  unsigned int n;
+  Support::Mutex m;
+  // signalled when all checks have finished
+  Support::Event e;
+};
+
+/**
+ * A single satisfiability check run by a thread.
+ *
+ */
+class Check : public Support::Runnable {
+protected:
+  FlatZincSpaceInfo* s;
+  set<int>& c;
+  vector<bool>& ret;
+  unsigned int i;
+  Checks& checks;
+public:
+  Check(FlatZincSpaceInfo* s0, set<int>& c0, vector<bool>& ret0,
+        unsigned int i0, Checks& checks0)
+    : s(s0), c(c0), ret(ret0), i(i0), checks(checks0) {}
+  virtual void run(void) {
+    bool r = runSpace(s, c);
+    checks.m.acquire();
+    ret[i] = r;
+    bool done = (--checks.n == 0);
+    checks.m.release();
+    if (done) {
+      checks.e.signal();
+    }
+  }
+};
+
+/**
+ * Return in ret[i] whether the space is not failed with the 
+ * constraints c[i], where the checks are run concurrently.
+ *
+ */
+void runSpaces(FlatZincSpaceInfo* s, vector<set<int> >& c,
+               vector<bool>& ret) {
+  ret.assign(c.size(), false);
+  if (c.size() == 1) {
+    ret[0] = runSpace(s, c[0]);
+    return;
+  }
+  Checks checks;
+  checks.n = c.size();
+  for (unsigned int i = 0; i < c.size(); i++) {
+    Support::Thread::run(new Check(s, c[i], ret, i, checks));
+  }
+  checks.e.wait();
+}
+
 /**
  * Wrapper that posts background constraints and sets up variables
  * needed for failureSearch().
  *
  */
 int findFirstFailure(FlatZincSpaceInfo* s, set<int> bgc, set<int> fgc) {
+  if (s->jobs > 1) {
+    return parallelFailureSearch(s, bgc, fgc);
+  }
+
   // create a clone for the search to use as a reference
   FlatZinc::FlatZincSpace* fg = (FlatZinc::FlatZincSpace*) s->fg->clone();
 
@@ -326,6 +429,58 @@ int failureSearch(FlatZincSpaceInfo* s, FlatZinc::FlatZincSpace* fg,
   return ret;
 }
 
+/**
+ * A parallel search for the constraint index k in fgc at which 
+ * bgc + fgc[0..k-1] is satisfiable but bgc + fgc[0..k] is not.
+ *
+ * In each round, as many prefixes of fgc as there are jobs are
+ * checked concurrently, which narrows the interval for k to one
+ * part out of jobs+1 parts.
+ *
+ */
+int parallelFailureSearch(FlatZincSpaceInfo* s, set<int> bgc, 
+                          set<int> fgc) {
+  vector<int> c(fgc.begin(), fgc.end());
+  // bgc + fgc is not satisfiable, so k is between lo and hi
+  int lo = 0;
+  int hi = c.size() - 1;
+
+  while (lo < hi) {
+    if (s->debug) {
+      cout << "Searching for k between: " << lo << "/" << hi << endl;
+    }
+
+    // check prefixes that end at the probes, all between lo and hi-1
+    int n = min(static_cast<int>(s->jobs), hi - lo);
+    vector<int> probe(n);
+    vector<set<int> > cs(n, bgc);
+    for (int j = 0; j < n; j++) {
+      probe[j] = lo + ((j + 1) * (hi - lo)) / (n + 1);
+      cs[j].insert(c.begin(), c.begin() + probe[j] + 1);
+    }
+    vector<bool> ret;
+    runSpaces(s, cs, ret);
+
+    // the first unsatisfiable prefix bounds k from above, 
+    // all satisfiable prefixes before bound k from below
+    for (int j = 0; j < n; j++) {
+      if (ret[j]) {
+        lo = probe[j] + 1;
+      } else {
+        hi = probe[j];
+        break;
+      }
+    }
+  }
+
+  if (s->debug) {
+    cout << "Failed at k: " << lo << endl;
+    cout << endl;
+  }
+
+  return lo;
+}
+
 void printSet(set<int> s) {
   set<int>::iterator it;
   for (it = s.begin(); it != s.end(); it++) {